@@ -0,0 +1,614 @@
+/**
+ * @file      adaptRepl.c
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Implementation of Adaptive page replacement module, ARC 
+ *            (Adaptive Replacement Cache) and LIRS (Low Inter-reference 
+ *            Recency Set) choosing which process to evict pages from. 
+ *            It includes
+ *              1. creating and destroying an adaptive page replacement
+ *              2. recording a process runs, stops running and finishes
+ *              3. choosing a process to evict and recording it is evicted
+ *              4. getting the number of hits and misses for statistics
+ *
+ *            A process is counted as the number of pages it requires, and 
+ *            running a process is a reference to it.
+ *            ARC keeps the processes in memory run once recently (T1) and 
+ *            more than once (T2), and the processes evicted from them (ghost 
+ *            lists B1 and B2). A ghost hit moves the target size of T1 
+ *            towards the list it hits, and pages are evicted from T1 if it 
+ *            is larger than the target, otherwise from T2.
+ *            LIRS keeps the processes with low inter-reference recency (LIR)
+ *            in memory, pages are evicted from the processes with high 
+ *            inter-reference recency (HIR) first. The stack orders LIR and 
+ *            recent HIR processes by recency and its bottom is always LIR, 
+ *            a HIR process run again while it is in the stack becomes LIR. 
+ *            The HIR processes not in memory in the stack are ghosts.
+ *            The ghost lists are bounded by the number of pages of memory
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#include "adaptRepl.h"
+#include "utilities.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+// ============================================================================
+// == | Constant Definitions 
+// ============================================================================
+#define STACK_SLOT              0
+#define QUEUE_SLOT              1
+#define T1_STATUS               'R'
+#define T2_STATUS               'F'
+#define LIR_STATUS              'L'
+#define HIR_STATUS              'H'
+#define HIR_RATIO               10
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+/**
+ * @brief  An adaptive page replacement records its policy, the number of 
+ *         pages of memory, and the number of hits and misses.
+ *         For ARC, it records the lists of processes in memory run once 
+ *         (T1) and more than once (T2), their ghost lists (B1 and B2), 
+ *         the target number of pages of T1, and whether the running process
+ *         is from B2.
+ *         For LIRS, it records the stack, the queue of HIR processes 
+ *         in memory, the list of HIR processes not in memory in the stack, 
+ *         the number of pages of LIR processes and the maximum of it.
+ */
+struct adapt_repl {
+    char policy;
+    long long int capacity;
+    long long int num_hit;
+    long long int num_miss;
+
+    ReplList recent;
+    ReplList frequent;
+    ReplList recent_ghost;
+    ReplList frequent_ghost;
+    long long int target;
+    int is_frequent_ghost;
+
+    ReplList stack;
+    ReplList hir_queue;
+    ReplList hir_ghost;
+    long long int lir_page;
+    long long int max_lir_page;
+};
+
+
+// ============================================================================
+// == | Function Prototypes
+// ============================================================================
+// Return the number of pages a process is counted as
+long long int get_weight(ProcessInfo *p);
+
+// Record a process is going to run for ARC
+void arc_access(AdaptRepl *repl, ProcessInfo *p);
+
+// Remove ghosts until the lists can fit a number of pages more for ARC
+void trim_arc_ghost(AdaptRepl *repl, long long int num_page);
+
+// Return the process to evict pages from for ARC
+ProcessInfo *arc_victim(AdaptRepl *repl);
+
+// Record all pages of a process are evicted for ARC
+void arc_evict(AdaptRepl *repl, ProcessInfo *p);
+
+// Record a process is going to run for LIRS
+void lirs_access(AdaptRepl *repl, ProcessInfo *p);
+
+// Return the process to evict pages from for LIRS
+ProcessInfo *lirs_victim(AdaptRepl *repl, ProcessInfo *p);
+
+// Record all pages of a process are evicted for LIRS
+void lirs_evict(AdaptRepl *repl, ProcessInfo *p);
+
+// Change a LIR process to HIR for LIRS
+void demote_lir(AdaptRepl *repl, ProcessInfo *p);
+
+// Remove the HIR processes from the bottom of the stack for LIRS
+void prune_stack(AdaptRepl *repl);
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+/**
+ * @brief  Create a new AdaptRepl of a policy for a number of pages
+ * 
+ * @param  mem_alloc_f      a memory allocation method flag, ARC or LIRS
+ * @param  total_page       number of pages of memory
+ * @return AdaptRepl*       return a pointer to the new AdaptRepl
+ */
+AdaptRepl *new_AdaptRepl(char mem_alloc_f, long long int total_page){
+
+    assert(mem_alloc_f == AR_M_FLAG || mem_alloc_f == LI_M_FLAG);
+
+    AdaptRepl *repl = (AdaptRepl *)malloc(sizeof *repl);
+    if (repl == NULL) {
+        fprintf(stderr, "Error: new_AdaptRepl() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Initalise value of the AdaptRepl
+    repl->policy = mem_alloc_f;
+    repl->capacity = total_page;
+    repl->num_hit = INITIAL;
+    repl->num_miss = INITIAL;
+
+    init_ReplList(&repl->recent, STACK_SLOT);
+    init_ReplList(&repl->frequent, STACK_SLOT);
+    init_ReplList(&repl->recent_ghost, STACK_SLOT);
+    init_ReplList(&repl->frequent_ghost, STACK_SLOT);
+    repl->target = INITIAL;
+    repl->is_frequent_ghost = 0;
+
+    /**
+     * The HIR processes in memory are at least 1 page, 
+     * and about 1 / HIR_RATIO of memory
+     */
+    init_ReplList(&repl->stack, STACK_SLOT);
+    init_ReplList(&repl->hir_queue, QUEUE_SLOT);
+    init_ReplList(&repl->hir_ghost, QUEUE_SLOT);
+    repl->lir_page = INITIAL;
+    long long int hir_page = total_page / HIR_RATIO;
+    if (hir_page < 1){
+        hir_page = 1;
+    }
+    repl->max_lir_page = total_page - hir_page;
+
+    return repl;
+}
+
+
+/**
+ * @brief  Destroy and free the memory associated with an AdaptRepl, 
+ *         the processes in the lists are not freed
+ * 
+ * @param  repl     an AdaptRepl
+ */
+void free_AdaptRepl(AdaptRepl *repl){
+
+    // Error if the AdaptRepl does not initalise
+    assert(repl != NULL);
+
+    // Free the AdaptRepl itself
+    free(repl);
+    repl = NULL;
+}
+
+
+/**
+ * @brief  Record a process is going to run, it is a hit if all its pages
+ *         are in memory. It is removed from the lists of processes to evict 
+ *         until it stops running. When its pages finish loading by the I/O
+ *         device, it is recorded again without counting a hit or miss. 
+ *         For LIRS, it moves back to the top of the stack, as it may become 
+ *         HIR while its pages are loaded; ARC does not move it until it 
+ *         stops
+ * 
+ * @param  repl         an AdaptRepl
+ * @param  p            a ProcessInfo data
+ * @param  is_loaded    1 if its pages just finish loading, 0 otherwise
+ */
+void access_repl(AdaptRepl *repl, ProcessInfo *p, int is_loaded){
+
+    if (!is_loaded){
+        if (p->num_page_in_mem == get_weight(p)){
+            repl->num_hit ++;
+        } else {
+            repl->num_miss ++;
+        }
+    }
+
+    if (repl->policy == AR_M_FLAG){
+        if (!is_loaded){
+            arc_access(repl, p);
+        }
+    } else {
+        lirs_access(repl, p);
+    }
+}
+
+
+/**
+ * @brief  Record a process stops running before it finishes, its pages can 
+ *         be evicted. For ARC, it is added to T1 if it run once recently, 
+ *         otherwise T2. For LIRS, a HIR process is added to the queue
+ * 
+ * @param  repl     an AdaptRepl
+ * @param  p        a ProcessInfo data with pages in memory
+ */
+void suspend_repl(AdaptRepl *repl, ProcessInfo *p){
+
+    if (repl->policy == AR_M_FLAG){
+        if (p->repl_status == T2_STATUS){
+            push_repl(&repl->frequent, p, get_weight(p));
+        } else {
+            push_repl(&repl->recent, p, get_weight(p));
+        }
+    } else if (p->repl_status == HIR_STATUS){
+        push_repl(&repl->hir_queue, p, get_weight(p));
+    }
+}
+
+
+/**
+ * @brief  Record a process finishes, it is removed from all lists
+ * 
+ * @param  repl     an AdaptRepl
+ * @param  p        a ProcessInfo data
+ */
+void finish_repl(AdaptRepl *repl, ProcessInfo *p){
+
+    if (p->repl_status == LIR_STATUS){
+        repl->lir_page -= get_weight(p);
+    }
+    p->repl_status = NULL_CHAR;
+    remove_repl(p, STACK_SLOT);
+    remove_repl(p, QUEUE_SLOT);
+
+    if (repl->policy == LI_M_FLAG){
+        prune_stack(repl);
+    }
+}
+
+
+/**
+ * @brief  Return the process to evict pages from, other than the running 
+ *         process. The process keeps its place until all its pages are 
+ *         evicted, so the same process is returned until then
+ * 
+ * @param  repl             an AdaptRepl
+ * @param  p                the running ProcessInfo data
+ * @return ProcessInfo*     the process to evict pages from
+ */
+ProcessInfo *get_repl_victim(AdaptRepl *repl, ProcessInfo *p){
+
+    ProcessInfo *victim;
+    if (repl->policy == AR_M_FLAG){
+        victim = arc_victim(repl);
+    } else {
+        victim = lirs_victim(repl, p);
+    }
+
+    // Error if no process other than the running process has pages in memory
+    assert(victim != NULL && victim != p);
+
+    return victim;
+}
+
+
+/**
+ * @brief  Record all pages of a process are evicted, it becomes a ghost
+ * 
+ * @param  repl     an AdaptRepl
+ * @param  p        a ProcessInfo data without pages in memory
+ */
+void evict_repl(AdaptRepl *repl, ProcessInfo *p){
+
+    if (repl->policy == AR_M_FLAG){
+        arc_evict(repl, p);
+    } else {
+        lirs_evict(repl, p);
+    }
+}
+
+
+/**
+ * @brief  Return the number of times a process runs with all its pages 
+ *         in memory
+ * 
+ * @param  repl             an AdaptRepl
+ * @return long long int    number of hits
+ */
+long long int get_repl_hit(AdaptRepl *repl){
+    return repl->num_hit;
+}
+
+
+/**
+ * @brief  Return the number of times a process runs with pages not in memory
+ * 
+ * @param  repl             an AdaptRepl
+ * @return long long int    number of misses
+ */
+long long int get_repl_miss(AdaptRepl *repl){
+    return repl->num_miss;
+}
+
+
+// ============================================================================
+// == | Auxillary Functions 
+// ============================================================================
+/**
+ * @brief  Return the number of pages a process is counted as, which is 
+ *         the number of pages it requires
+ * 
+ * @param  p                a ProcessInfo data
+ * @return long long int    number of pages
+ */
+long long int get_weight(ProcessInfo *p){
+    return p->total_require_page;
+}
+
+
+/**
+ * @brief  Record a process is going to run for ARC. A process in T1 or T2 
+ *         is moved to T2 when it stops. A process in B1 increases the 
+ *         target of T1, a process in B2 decreases it, and it is moved to T2.
+ *         Otherwise it is new, and moved to T1
+ * 
+ * @param  repl     an AdaptRepl
+ * @param  p        a ProcessInfo data
+ */
+void arc_access(AdaptRepl *repl, ProcessInfo *p){
+
+    long long int weight = get_weight(p);
+    ReplList *list = get_repl_list(p, STACK_SLOT);
+    ReplList *b1 = &repl->recent_ghost;
+    ReplList *b2 = &repl->frequent_ghost;
+    repl->is_frequent_ghost = 0;
+
+    if (list == &repl->recent || list == &repl->frequent){
+        p->repl_status = T2_STATUS;
+
+    } else if (list == b1){
+        // The target grows more if B2 is larger than B1
+        long long int delta = weight;
+        if (b2->num_page > b1->num_page && b1->num_page > 0){
+            delta = weight * b2->num_page / b1->num_page;
+        }
+        repl->target += delta;
+        if (repl->target > repl->capacity){
+            repl->target = repl->capacity;
+        }
+        p->repl_status = T2_STATUS;
+
+    } else if (list == b2){
+        // The target shrinks more if B1 is larger than B2
+        long long int delta = weight;
+        if (b1->num_page > b2->num_page && b2->num_page > 0){
+            delta = weight * b1->num_page / b2->num_page;
+        }
+        repl->target -= delta;
+        if (repl->target < 0){
+            repl->target = 0;
+        }
+        p->repl_status = T2_STATUS;
+        repl->is_frequent_ghost = 1;
+
+    } else {
+        p->repl_status = T1_STATUS;
+
+        // T1 and B1 together are within the memory
+        while (b1->size > 0 
+                && repl->recent.num_page + b1->num_page + weight 
+                    > repl->capacity){
+            remove_repl(get_repl_lru(b1), STACK_SLOT);
+        }
+        trim_arc_ghost(repl, weight);
+    }
+
+    remove_repl(p, STACK_SLOT);
+}
+
+
+/**
+ * @brief  Remove ghosts until all lists can fit a number of pages more 
+ *         within twice the memory for ARC, from B2 first
+ * 
+ * @param  repl         an AdaptRepl
+ * @param  num_page     number of pages
+ */
+void trim_arc_ghost(AdaptRepl *repl, long long int num_page){
+
+    ReplList *b1 = &repl->recent_ghost;
+    ReplList *b2 = &repl->frequent_ghost;
+    while ((b1->size > 0 || b2->size > 0)
+            && repl->recent.num_page + repl->frequent.num_page 
+                + b1->num_page + b2->num_page + num_page 
+                > 2 * repl->capacity){
+        if (b2->size > 0){
+            remove_repl(get_repl_lru(b2), STACK_SLOT);
+        } else {
+            remove_repl(get_repl_lru(b1), STACK_SLOT);
+        }
+    }
+}
+
+
+/**
+ * @brief  Return the process to evict pages from for ARC, the least 
+ *         recently used of T1 if T1 is larger than its target (or equal 
+ *         to it when the running process is from B2), otherwise of T2
+ * 
+ * @param  repl             an AdaptRepl
+ * @return ProcessInfo*     the process to evict pages from
+ */
+ProcessInfo *arc_victim(AdaptRepl *repl){
+
+    ReplList *t1 = &repl->recent;
+    if (t1->size > 0 
+        && (repl->frequent.size == 0 
+            || t1->num_page > repl->target 
+            || (repl->is_frequent_ghost && t1->num_page == repl->target))){
+        return get_repl_lru(t1);
+    }
+    return get_repl_lru(&repl->frequent);
+}
+
+
+/**
+ * @brief  Record all pages of a process are evicted for ARC, it is moved 
+ *         from T1 to B1, or from T2 to B2
+ * 
+ * @param  repl     an AdaptRepl
+ * @param  p        a ProcessInfo data without pages in memory
+ */
+void arc_evict(AdaptRepl *repl, ProcessInfo *p){
+
+    ReplList *list = get_repl_list(p, STACK_SLOT);
+    remove_repl(p, STACK_SLOT);
+
+    if (list == &repl->recent){
+        push_repl(&repl->recent_ghost, p, get_weight(p));
+    } else {
+        push_repl(&repl->frequent_ghost, p, get_weight(p));
+    }
+    trim_arc_ghost(repl, 0);
+}
+
+
+/**
+ * @brief  Record a process is going to run for LIRS. It is moved to the top
+ *         of the stack. A HIR process becomes LIR if it is in the stack 
+ *         (its reuse is more recent than the least recent LIR process) or 
+ *         the LIR processes have not filled their pages yet. The least 
+ *         recent LIR processes become HIR while the LIR processes are 
+ *         more than their pages
+ * 
+ * @param  repl     an AdaptRepl
+ * @param  p        a ProcessInfo data
+ */
+void lirs_access(AdaptRepl *repl, ProcessInfo *p){
+
+    long long int weight = get_weight(p);
+    int in_stack = get_repl_list(p, STACK_SLOT) == &repl->stack;
+
+    // The running process is not in the queue or ghost list
+    remove_repl(p, QUEUE_SLOT);
+    remove_repl(p, STACK_SLOT);
+
+    if (p->repl_status != LIR_STATUS){
+        if (in_stack || repl->lir_page + weight <= repl->max_lir_page){
+            p->repl_status = LIR_STATUS;
+            repl->lir_page += weight;
+        } else {
+            p->repl_status = HIR_STATUS;
+        }
+    }
+    push_repl(&repl->stack, p, weight);
+    prune_stack(repl);
+
+    while (repl->lir_page > repl->max_lir_page){
+        ProcessInfo *bottom = get_repl_lru(&repl->stack);
+        if (bottom == NULL || bottom == p){
+            break;
+        }
+        demote_lir(repl, bottom);
+        prune_stack(repl);
+    }
+}
+
+
+/**
+ * @brief  Return the process to evict pages from for LIRS, the first HIR 
+ *         process in memory of the queue. If there is none, it is the least
+ *         recent LIR process in memory other than the running process, 
+ *         the processes being loaded by the I/O device and the processes 
+ *         running on other cores
+ * 
+ * @param  repl             an AdaptRepl
+ * @param  p                the running ProcessInfo data
+ * @return ProcessInfo*     the process to evict pages from
+ */
+ProcessInfo *lirs_victim(AdaptRepl *repl, ProcessInfo *p){
+
+    ProcessInfo *victim = get_repl_lru(&repl->hir_queue);
+    if (victim != NULL){
+        return victim;
+    }
+
+    for (victim = get_repl_lru(&repl->stack); victim != NULL; 
+            victim = get_repl_prev(victim, STACK_SLOT)){
+        if (victim != p && victim->num_page_in_mem > 0 
+            && victim->io_done_time == INVALID 
+            && victim->core_id == INVALID){
+            return victim;
+        }
+    }
+    return NULL;
+}
+
+
+/**
+ * @brief  Record all pages of a process are evicted for LIRS, it becomes 
+ *         HIR. If it is in the stack, it is a ghost until the ghosts are 
+ *         more than the memory
+ * 
+ * @param  repl     an AdaptRepl
+ * @param  p        a ProcessInfo data without pages in memory
+ */
+void lirs_evict(AdaptRepl *repl, ProcessInfo *p){
+
+    remove_repl(p, QUEUE_SLOT);
+    if (p->repl_status == LIR_STATUS){
+        repl->lir_page -= get_weight(p);
+        p->repl_status = HIR_STATUS;
+    }
+
+    if (get_repl_list(p, STACK_SLOT) == &repl->stack){
+        push_repl(&repl->hir_ghost, p, get_weight(p));
+
+        // The oldest ghosts are removed from the stack
+        while (repl->hir_ghost.num_page > repl->capacity){
+            ProcessInfo *ghost = get_repl_lru(&repl->hir_ghost);
+            remove_repl(ghost, QUEUE_SLOT);
+            remove_repl(ghost, STACK_SLOT);
+        }
+    }
+
+    prune_stack(repl);
+}
+
+
+/**
+ * @brief  Change a LIR process at the bottom of the stack to HIR for LIRS, 
+ *         it is added to the queue as it has pages in memory, unless it is
+ *         running on another core or its pages are being loaded by the I/O
+ *         device, as in lirs_victim()
+ * 
+ * @param  repl     an AdaptRepl
+ * @param  p        a LIR ProcessInfo data
+ */
+void demote_lir(AdaptRepl *repl, ProcessInfo *p){
+
+    assert(p->repl_status == LIR_STATUS);
+
+    p->repl_status = HIR_STATUS;
+    repl->lir_page -= get_weight(p);
+    remove_repl(p, STACK_SLOT);
+
+    if (p->num_page_in_mem > 0 && p->core_id == INVALID 
+        && p->io_done_time == INVALID){
+        push_repl(&repl->hir_queue, p, get_weight(p));
+    }
+}
+
+
+/**
+ * @brief  Remove the HIR processes from the bottom of the stack for LIRS,
+ *         so its bottom is LIR. A ghost removed is forgotten
+ * 
+ * @param  repl     an AdaptRepl
+ */
+void prune_stack(AdaptRepl *repl){
+
+    ProcessInfo *bottom = get_repl_lru(&repl->stack);
+    while (bottom != NULL && bottom->repl_status != LIR_STATUS){
+        remove_repl(bottom, STACK_SLOT);
+        if (get_repl_list(bottom, QUEUE_SLOT) == &repl->hir_ghost){
+            remove_repl(bottom, QUEUE_SLOT);
+        }
+        bottom = get_repl_lru(&repl->stack);
+    }
+}
@@ -0,0 +1,58 @@
+/**
+ * @file      adaptRepl.h
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Adaptive page replacement module, ARC (Adaptive Replacement 
+ *            Cache) and LIRS (Low Inter-reference Recency Set) choosing 
+ *            which process to evict pages from. It includes
+ *              1. creating and destroying an adaptive page replacement
+ *              2. recording a process runs, stops running and finishes
+ *              3. choosing a process to evict and recording it is evicted
+ *              4. getting the number of hits and misses for statistics
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#ifndef ADAPTREPL_H
+#define ADAPTREPL_H
+
+#include "processInfo.h"
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+typedef struct adapt_repl AdaptRepl;
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+// Create a new AdaptRepl of a policy for a number of pages
+AdaptRepl *new_AdaptRepl(char mem_alloc_f, long long int total_page);
+
+// Destroy and free the memory associated with an AdaptRepl
+void free_AdaptRepl(AdaptRepl *repl);
+
+// Record a process is going to run, it can not be evicted until it stops
+void access_repl(AdaptRepl *repl, ProcessInfo *p, int is_loaded);
+
+// Record a process stops running before it finishes
+void suspend_repl(AdaptRepl *repl, ProcessInfo *p);
+
+// Record a process finishes, it is removed from all lists
+void finish_repl(AdaptRepl *repl, ProcessInfo *p);
+
+// Return the process to evict pages from, other than the running process
+ProcessInfo *get_repl_victim(AdaptRepl *repl, ProcessInfo *p);
+
+// Record all pages of a process are evicted
+void evict_repl(AdaptRepl *repl, ProcessInfo *p);
+
+// Return the number of times a process runs with all its pages in memory
+long long int get_repl_hit(AdaptRepl *repl);
+
+// Return the number of times a process runs with pages not in memory
+long long int get_repl_miss(AdaptRepl *repl);
+
+#endif
@@ -0,0 +1,183 @@
+/**
+ * @file      benchMemory.c
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Benchmark of the page allocation of virtual memory. It includes
+ *              1. fill a large memory to 90% with one process
+ *              2. time allocating pages to processes in the last 10%,
+ *                  with the free bitmap and a linear scan of the pages
+ *              3. print the size of the owner table per page
+ *
+ *            Usage: ./benchMemory [number of pages] [number of runs]
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#include "memoryAlloc.h"
+#include "utilities.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+// ============================================================================
+// == | Constant Definitions
+// ============================================================================
+#define DEFAULT_BENCH_PAGE      1048576
+#define DEFAULT_BENCH_RUN       200
+#define BENCH_CLAIM_PAGE        1024
+#define BENCH_FILL_PERCENT      90
+
+
+// ============================================================================
+// == | Function Prototypes
+// ============================================================================
+// Return the current time in microseconds
+double get_us();
+
+// Find the empty pages by scanning every page of the memory
+long long int scan_pages(long long int *owner_lst, long long int total_page,
+                            long long int *claim_list, long long int num_page);
+
+
+// ============================================================================
+// == | Main Functions
+// ============================================================================
+/**
+ * @brief   Time the page allocation of virtual memory in a large memory
+ *
+ * @param  argc   number of inputs
+ * @param  argv   an array of inputs
+ * @return        if no fail exits, return 0
+ */
+int main (int argc, char **argv){
+
+    long long int total_page = DEFAULT_BENCH_PAGE;
+    long long int num_run = DEFAULT_BENCH_RUN;
+    if (argc > 1){
+        total_page = atoll(argv[1]);
+    }
+    if (argc > 2){
+        num_run = atoll(argv[2]);
+    }
+    long long int num_fill = total_page / 100 * BENCH_FILL_PERCENT;
+    if (num_run <= 0 || num_fill + BENCH_CLAIM_PAGE > total_page){
+        fprintf(stderr, "Usage: %s [number of pages] [number of runs]\n",
+                    argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    // One process fills the memory, then each run allocates a new process
+    ProcessArena *arena = new_ProcessArena(num_run + 1);
+    CPUInfo *cpu = new_CPUInfo();
+    cpu->memory = new_MemoryInfo(total_page, arena);
+    cpu->memory->page_size = KB_PAGES;
+    cpu->is_quiet = 1;
+
+    ProcessInfo *fill = new_ProcessInfo(arena);
+    fill->arrive_time = 0;
+    fill->p_id = 0;
+    fill->mem_size_req = num_fill * KB_PAGES;
+    fill->job_time = 1;
+    fill->remaining_time = 1;
+    mem_alloc_func(VM_M_FLAG, cpu, fill);
+
+    double bitmap_us = 0;
+    for (long long int i = 1; i <= num_run; i++){
+        ProcessInfo *p = new_ProcessInfo(arena);
+        p->arrive_time = 0;
+        p->p_id = i;
+        p->mem_size_req = BENCH_CLAIM_PAGE * KB_PAGES;
+        p->job_time = 1;
+        p->remaining_time = 1;
+
+        double start = get_us();
+        mem_alloc_func(VM_M_FLAG, cpu, p);
+        bitmap_us += get_us() - start;
+        print_finished(VM_M_FLAG, cpu, p, 0);
+    }
+
+    /**
+     * The same allocation by scanning an owner table of a process id per
+     * page from the first page, as the memory did before the free bitmap
+     */
+    long long int *owner_lst = malloc(total_page * sizeof(*owner_lst));
+    long long int *claim_list = malloc(BENCH_CLAIM_PAGE * sizeof(*claim_list));
+    if (owner_lst == NULL || claim_list == NULL){
+        fprintf(stderr, "Error: main() malloc fails\n");
+        exit(EXIT_FAILURE);
+    }
+    for (long long int i = 0; i < total_page; i++){
+        owner_lst[i] = i < num_fill ? 0 : INVALID;
+    }
+    double scan_us = 0;
+    for (long long int i = 1; i <= num_run; i++){
+        double start = get_us();
+        long long int num_claim = scan_pages(owner_lst, total_page,
+                                                claim_list, BENCH_CLAIM_PAGE);
+        for (long long int j = 0; j < num_claim; j++){
+            owner_lst[claim_list[j]] = i;
+        }
+        scan_us += get_us() - start;
+        for (long long int j = 0; j < num_claim; j++){
+            owner_lst[claim_list[j]] = INVALID;
+        }
+    }
+
+    fprintf(stdout, "pages=%lld, filled=%d%%, claim=%d pages, runs=%lld\n",
+        total_page, BENCH_FILL_PERCENT, BENCH_CLAIM_PAGE, num_run);
+    fprintf(stdout, "free bitmap: %.1f us/alloc\n", bitmap_us / num_run);
+    fprintf(stdout, "page scan: %.1f us/alloc\n", scan_us / num_run);
+    fprintf(stdout, "owner table: %zu bytes/page, %.1f MB\n",
+        sizeof(*cpu->memory->owner_lst),
+        (double)total_page * sizeof(*cpu->memory->owner_lst) / 1048576);
+
+    print_finished(VM_M_FLAG, cpu, fill, 0);
+    free(owner_lst);
+    free(claim_list);
+    free_CPUInfo(cpu);
+    free_ProcessArena(arena);
+
+    return 0;
+}
+
+
+// ============================================================================
+// == | Auxillary Functions
+// ============================================================================
+/**
+ * @brief  Return the current time in microseconds
+ *
+ * @return double   the monotonic time in microseconds
+ */
+double get_us(){
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+
+/**
+ * @brief  Find the empty pages by scanning every page of the memory from
+ *         the first page
+ *
+ * @param  owner_lst        the process id of each page, INVALID if empty
+ * @param  total_page       number of pages in the memory
+ * @param  claim_list       a list to store the empty pages found
+ * @param  num_page         number of pages need to be found
+ * @return long long int    number of empty pages found
+ */
+long long int scan_pages(long long int *owner_lst, long long int total_page,
+                            long long int *claim_list, long long int num_page){
+
+    long long int num_claim = 0;
+    for (long long int i = 0; i < total_page && num_claim < num_page; i++){
+        if (owner_lst[i] == INVALID){
+            claim_list[num_claim] = i;
+            num_claim ++;
+        }
+    }
+    return num_claim;
+}
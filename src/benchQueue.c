@@ -0,0 +1,370 @@
+/**
+ * @file      benchQueue.c
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Benchmark of the priority queue. It includes
+ *              1. enqueue then dequeue processes by job time with a sorted
+ *                  list which gets the priority value by a string flag,
+ *                  as the queue did before the binary heap
+ *              2. count the comparisons of the binary heap of the Queue
+ *              3. time the Queue on the same processes
+ *
+ *            Usage: ./benchQueue [number of processes]
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#include "queue.h"
+#include "utilities.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <string.h>
+#include <time.h>
+
+
+// ============================================================================
+// == | Constant Definitions
+// ============================================================================
+#define DEFAULT_BENCH_PROC      20000
+#define MAX_LIST_BENCH_PROC     100000
+#define BENCH_MAX_JOB_T         1000
+#define BENCH_SEED              30023
+
+#define LIST_ARRIVAL_T          "ARRT"
+#define LIST_LAST_EXE_T         "LASTET"
+#define LIST_JOB_T              "JOBT"
+#define LIST_MAX_PAGE           "MAXPAGE"
+#define LIST_COMPLETE_T         "COMPLETET"
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+typedef struct list_node ListNode;
+/**
+ * @brief  A node of the sorted list, linked to its previous and next node
+ */
+struct list_node {
+    ProcessInfo *process;
+    ListNode *prev;
+    ListNode *next;
+};
+
+
+/**
+ * @brief  A node of the counting heap and the priority value it was given
+ */
+typedef struct {
+    long long int priority;
+    ProcessInfo *process;
+} HeapNode;
+
+
+// ============================================================================
+// == | Function Prototypes
+// ============================================================================
+// Return the current time in seconds
+double get_sec();
+
+// Get the priority value of a process by a string flag
+long long int get_list_priority(ProcessInfo *p, char *prio_flag);
+
+// Enqueue then dequeue processes with a sorted list, return the comparisons
+long long int run_list(ProcessInfo *processes, long long int num_proc,
+                        char *prio_flag);
+
+// Check if heap node a should be dequeued before heap node b
+int is_heap_before(HeapNode *a, HeapNode *b, long long int *num_compare);
+
+// Enqueue then dequeue processes with a heap, return the comparisons
+long long int run_heap(ProcessInfo *processes, long long int num_proc);
+
+// Enqueue then dequeue processes with a Queue
+void run_queue(ProcessInfo *processes, long long int num_proc);
+
+// Print the comparisons and time of a run
+void print_bench(char *name, long long int num_proc,
+                    long long int num_compare, double sec);
+
+
+// ============================================================================
+// == | Main Functions
+// ============================================================================
+/**
+ * @brief   Count and time the comparisons of enqueuing then dequeuing
+ *          processes by job time
+ *
+ * @param  argc   number of inputs
+ * @param  argv   an array of inputs
+ * @return        if no fail exits, return 0
+ */
+int main (int argc, char **argv){
+
+    long long int num_proc = DEFAULT_BENCH_PROC;
+    if (argc > 1){
+        num_proc = atoll(argv[1]);
+    }
+    if (num_proc <= 0){
+        fprintf(stderr, "Usage: %s [number of processes]\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    // Processes of random job time, the same in every run
+    ProcessArena *arena = new_ProcessArena(num_proc);
+    srand(BENCH_SEED);
+    for (long long int i = 0; i < num_proc; i++){
+        ProcessInfo *p = new_ProcessInfo(arena);
+        p->arrive_time = 0;
+        p->p_id = i;
+        p->job_time = rand() % BENCH_MAX_JOB_T + 1;
+        p->remaining_time = p->job_time;
+    }
+
+    // The sorted list takes quadratic time, so it only runs on fewer
+    if (num_proc <= MAX_LIST_BENCH_PROC){
+        double start = get_sec();
+        long long int num_compare = run_list(arena->processes, num_proc,
+                                                LIST_JOB_T);
+        print_bench("sorted list + strcmp", num_proc, num_compare,
+                        get_sec() - start);
+    }
+
+    /**
+     * The Queue does not count its comparisons, the counting heap makes
+     * the same comparisons in the same order, then the Queue is timed
+     */
+    long long int num_compare = run_heap(arena->processes, num_proc);
+    double start = get_sec();
+    run_queue(arena->processes, num_proc);
+    print_bench("heap + per-queue key", num_proc, num_compare,
+                    get_sec() - start);
+
+    free_ProcessArena(arena);
+
+    return 0;
+}
+
+
+// ============================================================================
+// == | Auxillary Functions
+// ============================================================================
+/**
+ * @brief  Return the current time in seconds
+ *
+ * @return double   the monotonic time in seconds
+ */
+double get_sec(){
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+
+/**
+ * @brief  Get the priority value of a process by a string flag
+ *
+ * @param  p                a process
+ * @param  prio_flag        a priority flag string
+ * @return long long int    a priority value
+ */
+long long int get_list_priority(ProcessInfo *p, char *prio_flag){
+
+    if (strcmp(prio_flag, LIST_ARRIVAL_T) == 0){
+        return p->arrive_time;
+    } else if (strcmp(prio_flag, LIST_JOB_T) == 0){
+        return p->job_time;
+    } else if (strcmp(prio_flag, LIST_LAST_EXE_T) == 0){
+        return p->last_execution_time;
+    } else if (strcmp(prio_flag, LIST_MAX_PAGE) == 0){
+        return p->num_page_in_mem;
+    } else if (strcmp(prio_flag, LIST_COMPLETE_T) == 0){
+        return p->complete_time;
+    } else {
+        fprintf(stderr, "Invalid priority flag");
+        exit(EXIT_FAILURE);
+    }
+}
+
+
+/**
+ * @brief  Enqueue all processes to a sorted list, walking from the last
+ *         node, then dequeue them all from the first node
+ *
+ * @param  processes        an array of processes
+ * @param  num_proc         number of processes
+ * @param  prio_flag        a priority flag string
+ * @return long long int    number of priority comparisons
+ */
+long long int run_list(ProcessInfo *processes, long long int num_proc,
+                        char *prio_flag){
+
+    ListNode *nodes = malloc(num_proc * sizeof(*nodes));
+    if (nodes == NULL){
+        fprintf(stderr, "Error: run_list() malloc fails\n");
+        exit(EXIT_FAILURE);
+    }
+
+    long long int num_compare = 0;
+    ListNode *head = NULL;
+    ListNode *last = NULL;
+    for (long long int i = 0; i < num_proc; i++){
+        ListNode *node = &nodes[i];
+        node->process = &processes[i];
+
+        // Find the last node which is not after the new node
+        ListNode *prev = last;
+        while (prev != NULL){
+            num_compare++;
+            long long int prio = get_list_priority(prev->process, prio_flag);
+            long long int node_prio = get_list_priority(node->process,
+                                                        prio_flag);
+            if (prio < node_prio || (prio == node_prio
+                && prev->process->p_id < node->process->p_id)){
+                break;
+            }
+            prev = prev->prev;
+        }
+
+        node->prev = prev;
+        node->next = prev == NULL ? head : prev->next;
+        if (node->next == NULL){
+            last = node;
+        } else {
+            node->next->prev = node;
+        }
+        if (prev == NULL){
+            head = node;
+        } else {
+            prev->next = node;
+        }
+    }
+
+    while (head != NULL){
+        head = head->next;
+    }
+    free(nodes);
+
+    return num_compare;
+}
+
+
+/**
+ * @brief  Check if heap node a should be dequeued before heap node b,
+ *         as the Queue does, and count the comparison
+ *
+ * @param  a            a heap node
+ * @param  b            a heap node
+ * @param  num_compare  number of comparisons made
+ * @return int          1 if a has smaller priority value, or the same
+ *                      priority value and smaller process id. Otherwise, 0
+ */
+int is_heap_before(HeapNode *a, HeapNode *b, long long int *num_compare){
+    (*num_compare)++;
+    if (a->priority != b->priority){
+        return a->priority < b->priority;
+    }
+    return a->process->p_id < b->process->p_id;
+}
+
+
+/**
+ * @brief  Enqueue all processes to a binary heap then dequeue them all,
+ *         moving the nodes as the Queue does
+ *
+ * @param  processes        an array of processes
+ * @param  num_proc         number of processes
+ * @return long long int    number of priority comparisons
+ */
+long long int run_heap(ProcessInfo *processes, long long int num_proc){
+
+    HeapNode *heap = malloc(num_proc * sizeof(*heap));
+    if (heap == NULL){
+        fprintf(stderr, "Error: run_heap() malloc fails\n");
+        exit(EXIT_FAILURE);
+    }
+
+    long long int num_compare = 0;
+    for (long long int size = 0; size < num_proc; size++){
+        HeapNode node = {processes[size].job_time, &processes[size]};
+        long long int index = size;
+        while (index > 0){
+            long long int parent = (index - 1) / 2;
+            if (!is_heap_before(&node, &heap[parent], &num_compare)){
+                break;
+            }
+            heap[index] = heap[parent];
+            index = parent;
+        }
+        heap[index] = node;
+    }
+
+    for (long long int size = num_proc - 1; size > 0; size--){
+        HeapNode node = heap[size];
+        long long int index = 0;
+        while (2 * index + 1 < size){
+            long long int child = 2 * index + 1;
+            if (child + 1 < size
+                && is_heap_before(&heap[child + 1], &heap[child],
+                                    &num_compare)){
+                child++;
+            }
+            if (!is_heap_before(&heap[child], &node, &num_compare)){
+                break;
+            }
+            heap[index] = heap[child];
+            index = child;
+        }
+        heap[index] = node;
+    }
+    free(heap);
+
+    return num_compare;
+}
+
+
+/**
+ * @brief  Enqueue all processes to a Queue by job time then dequeue them all
+ *
+ * @param  processes    an array of processes
+ * @param  num_proc     number of processes
+ */
+void run_queue(ProcessInfo *processes, long long int num_proc){
+
+    Queue *queue = new_queue(PRIO_JOB_T);
+    for (long long int i = 0; i < num_proc; i++){
+        enqueue(queue, &processes[i]);
+    }
+
+    // Each process must come out in job time order
+    ProcessInfo *prev = NULL;
+    while (get_queue_size(queue) > 0){
+        ProcessInfo *p = dequeue(queue);
+        if (prev != NULL && (prev->job_time > p->job_time
+            || (prev->job_time == p->job_time && prev->p_id > p->p_id))){
+            fprintf(stderr, "Error: run_queue() dequeue out of order\n");
+            exit(EXIT_FAILURE);
+        }
+        prev = p;
+    }
+    free_queue(queue);
+}
+
+
+/**
+ * @brief  Print the comparisons and time of a run
+ *
+ * @param  name         name of the queue
+ * @param  num_proc     number of processes
+ * @param  num_compare  number of priority comparisons
+ * @param  sec          time taken in seconds
+ */
+void print_bench(char *name, long long int num_proc,
+                    long long int num_compare, double sec){
+
+    fprintf(stdout, "%s, n=%lld: %.2fM comparisons, %.3fs, "
+        "%.0f M comparisons/s\n", name, num_proc, num_compare / 1e6, sec,
+        num_compare / 1e6 / sec);
+}
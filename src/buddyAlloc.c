@@ -0,0 +1,347 @@
+/**
+ * @file      buddyAlloc.c
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Implementation of Buddy allocator module, memory pages are 
+ *            allocated in blocks of a power-of-two number of pages. 
+ *            It includes
+ *              1. creating and destroying a buddy allocator
+ *              2. allocating and freeing a block, splitting and joining 
+ *                 blocks with their buddies
+ *              3. getting the number of splits and joins for statistics
+ *
+ *            A block of 2^k pages (order k) always starts at a multiple of 
+ *            2^k, and its buddy is the block of the same order next to it 
+ *            (start XOR 2^k). The free blocks of each order are kept in a 
+ *            doubly linked list, so allocating and freeing a block take 
+ *            O(log n) time for at most one split or join per order
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#include "buddyAlloc.h"
+#include "utilities.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+/**
+ * @brief  A buddy allocator records the total number of pages, the order 
+ *         of the largest block, the first free block of each order, 
+ *         the next and previous free blocks of the same order, the order 
+ *         of the block from each start page and whether it is free, 
+ *         and the number of splits and joins
+ */
+struct buddy_alloc {
+    long long int total_page;
+    int max_order;
+    long long int *free_head;
+    long long int *next;
+    long long int *prev;
+    int *order;
+    char *is_free;
+    long long int num_split;
+    long long int num_merge;
+};
+
+
+// ============================================================================
+// == | Function Prototypes
+// ============================================================================
+// Return the smallest order of a block which can fit a number of pages
+int get_order(long long int num_page);
+
+// Add a free block of an order to its free list
+void push_free(BuddyAlloc *buddy, long long int start, int order);
+
+// Remove a free block from its free list
+void remove_free(BuddyAlloc *buddy, long long int start);
+
+
+// ============================================================================
+// == | Main Functions
+// ============================================================================
+/**
+ * @brief  Create a new BuddyAlloc with all pages free. If the number of pages
+ *         is not a power of two, the pages are split into the largest blocks
+ *         which start at a multiple of their size
+ * 
+ * @param  total_page       total number of pages
+ * @return BuddyAlloc*      return a pointer to the new BuddyAlloc
+ */
+BuddyAlloc *new_BuddyAlloc(long long int total_page){
+
+    // Error if there is no page to split into blocks
+    assert(total_page > 0);
+
+    BuddyAlloc *buddy = (BuddyAlloc *)malloc(sizeof *buddy);
+    if (buddy == NULL) {
+        fprintf(stderr, "Error: new_BuddyAlloc() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Initalise value of the BuddyAlloc
+    buddy->total_page = total_page;
+    buddy->max_order = 0;
+    while ((2LL << buddy->max_order) <= total_page){
+        buddy->max_order ++;
+    }
+    buddy->num_split = INITIAL;
+    buddy->num_merge = INITIAL;
+
+    // Initalise the free lists and the block information of each page
+    buddy->free_head = (long long int *)malloc(
+                        (buddy->max_order + 1) * sizeof(long long int));
+    buddy->next = (long long int *)malloc(total_page * sizeof(long long int));
+    buddy->prev = (long long int *)malloc(total_page * sizeof(long long int));
+    buddy->order = (int *)malloc(total_page * sizeof(int));
+    buddy->is_free = (char *)malloc(total_page * sizeof(char));
+    if (buddy->free_head == NULL || buddy->next == NULL 
+        || buddy->prev == NULL || buddy->order == NULL 
+        || buddy->is_free == NULL) {
+        fprintf(stderr, 
+            "Error: new_BuddyAlloc() malloc of block lists returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i <= buddy->max_order; i++){
+        buddy->free_head[i] = INVALID;
+    }
+    for (long long int i = 0; i < total_page; i++){
+        buddy->order[i] = INVALID;
+        buddy->is_free[i] = 0;
+    }
+
+    // Split all pages into the largest aligned free blocks
+    long long int start = 0;
+    while (start < total_page){
+        int order = buddy->max_order;
+        while (start % (1LL << order) != 0 
+                || start + (1LL << order) > total_page){
+            order --;
+        }
+        push_free(buddy, start, order);
+        start += 1LL << order;
+    }
+
+    return buddy;
+}
+
+
+/**
+ * @brief  Destroy and free the memory associated with a BuddyAlloc
+ * 
+ * @param  buddy    a BuddyAlloc
+ */
+void free_BuddyAlloc(BuddyAlloc *buddy){
+
+    // Error if the BuddyAlloc does not initalise
+    assert(buddy != NULL);
+
+    // Free the memory associated with a BuddyAlloc
+    free(buddy->free_head);
+    free(buddy->next);
+    free(buddy->prev);
+    free(buddy->order);
+    free(buddy->is_free);
+
+    // Free the BuddyAlloc itself
+    free(buddy);
+    buddy = NULL;
+}
+
+
+/**
+ * @brief  Return the number of pages of the block needed for a number of 
+ *         pages, which is the smallest power of two not less than it. 
+ *         It is at most the largest block of the memory
+ * 
+ * @param  buddy            a BuddyAlloc
+ * @param  num_page         number of pages
+ * @return long long int    number of pages of the block
+ */
+long long int get_block_page(BuddyAlloc *buddy, long long int num_page){
+    int order = get_order(num_page);
+    if (order > buddy->max_order){
+        order = buddy->max_order;
+    }
+    return 1LL << order;
+}
+
+
+/**
+ * @brief  Return if a free block of a number of pages can be allocated, 
+ *         i.e. there is a free block of the same or a larger order
+ * 
+ * @param  buddy        a BuddyAlloc
+ * @param  block_page   number of pages of the block, a power of two
+ * @return int          1 if a block can be allocated, 0 otherwise
+ */
+int can_alloc_block(BuddyAlloc *buddy, long long int block_page){
+    for (int i = get_order(block_page); i <= buddy->max_order; i++){
+        if (buddy->free_head[i] != INVALID){
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+/**
+ * @brief  Allocate a block of a number of pages. The smallest free block 
+ *         which can fit is split in halves until it is the required size,
+ *         the halves not used are added to the free lists
+ * 
+ * @param  buddy            a BuddyAlloc
+ * @param  block_page       number of pages of the block, a power of two
+ * @return long long int    the start page of the block allocated, 
+ *                          INVALID (-1) if no free block can fit
+ */
+long long int alloc_block(BuddyAlloc *buddy, long long int block_page){
+
+    int order = get_order(block_page);
+    int curr_order = order;
+    while (curr_order <= buddy->max_order 
+            && buddy->free_head[curr_order] == INVALID){
+        curr_order ++;
+    }
+    if (curr_order > buddy->max_order){
+        return INVALID;
+    }
+
+    long long int start = buddy->free_head[curr_order];
+    remove_free(buddy, start);
+
+    // Split the block, and keep the lower half until it is the required size
+    while (curr_order > order){
+        curr_order --;
+        push_free(buddy, start + (1LL << curr_order), curr_order);
+        buddy->num_split ++;
+    }
+    buddy->order[start] = order;
+
+    return start;
+}
+
+
+/**
+ * @brief  Free a block from its start page. While its buddy is also free, 
+ *         the two blocks are joined into a block of the next order
+ * 
+ * @param  buddy    a BuddyAlloc
+ * @param  start    the start page of an allocated block
+ */
+void free_block(BuddyAlloc *buddy, long long int start){
+
+    int order = buddy->order[start];
+    assert(order != INVALID && !buddy->is_free[start]);
+
+    while (order < buddy->max_order){
+        long long int buddy_start = start ^ (1LL << order);
+        if (buddy_start + (1LL << order) > buddy->total_page 
+            || !buddy->is_free[buddy_start] 
+            || buddy->order[buddy_start] != order){
+            break;
+        }
+
+        // Join the block with its buddy, the lower one is the new block
+        remove_free(buddy, buddy_start);
+        if (buddy_start < start){
+            buddy->order[start] = INVALID;
+            start = buddy_start;
+        } else {
+            buddy->order[buddy_start] = INVALID;
+        }
+        order ++;
+        buddy->num_merge ++;
+    }
+
+    push_free(buddy, start, order);
+}
+
+
+/**
+ * @brief  Return the number of times a block is split
+ * 
+ * @param  buddy            a BuddyAlloc
+ * @return long long int    number of splits
+ */
+long long int get_num_split(BuddyAlloc *buddy){
+    return buddy->num_split;
+}
+
+
+/**
+ * @brief  Return the number of times a block is joined with its buddy
+ * 
+ * @param  buddy            a BuddyAlloc
+ * @return long long int    number of joins
+ */
+long long int get_num_merge(BuddyAlloc *buddy){
+    return buddy->num_merge;
+}
+
+
+// ============================================================================
+// == | Auxillary Functions 
+// ============================================================================
+/**
+ * @brief  Return the smallest order of a block which can fit a number of 
+ *         pages, i.e. the smallest k where 2^k is not less than it
+ * 
+ * @param  num_page     number of pages
+ * @return int          the order of the block
+ */
+int get_order(long long int num_page){
+    int order = 0;
+    while ((1LL << order) < num_page){
+        order ++;
+    }
+    return order;
+}
+
+
+/**
+ * @brief  Add a free block of an order to the front of its free list
+ * 
+ * @param  buddy    a BuddyAlloc
+ * @param  start    the start page of the block
+ * @param  order    the order of the block
+ */
+void push_free(BuddyAlloc *buddy, long long int start, int order){
+    buddy->order[start] = order;
+    buddy->is_free[start] = 1;
+
+    buddy->prev[start] = INVALID;
+    buddy->next[start] = buddy->free_head[order];
+    if (buddy->free_head[order] != INVALID){
+        buddy->prev[buddy->free_head[order]] = start;
+    }
+    buddy->free_head[order] = start;
+}
+
+
+/**
+ * @brief  Remove a free block from its free list
+ * 
+ * @param  buddy    a BuddyAlloc
+ * @param  start    the start page of the block
+ */
+void remove_free(BuddyAlloc *buddy, long long int start){
+    int order = buddy->order[start];
+    assert(buddy->is_free[start]);
+
+    if (buddy->prev[start] != INVALID){
+        buddy->next[buddy->prev[start]] = buddy->next[start];
+    } else {
+        buddy->free_head[order] = buddy->next[start];
+    }
+    if (buddy->next[start] != INVALID){
+        buddy->prev[buddy->next[start]] = buddy->prev[start];
+    }
+    buddy->is_free[start] = 0;
+}
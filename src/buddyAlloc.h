@@ -0,0 +1,52 @@
+/**
+ * @file      buddyAlloc.h
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Buddy allocator module, memory pages are allocated in blocks 
+ *            of a power-of-two number of pages. It includes
+ *              1. creating and destroying a buddy allocator
+ *              2. allocating and freeing a block, splitting and joining 
+ *                 blocks with their buddies
+ *              3. getting the number of splits and joins for statistics
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#ifndef BUDDYALLOC_H
+#define BUDDYALLOC_H
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+typedef struct buddy_alloc BuddyAlloc;
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+// Create a new BuddyAlloc with all pages free
+BuddyAlloc *new_BuddyAlloc(long long int total_page);
+
+// Destroy and free the memory associated with a BuddyAlloc
+void free_BuddyAlloc(BuddyAlloc *buddy);
+
+// Return the number of pages of the block needed for a number of pages
+long long int get_block_page(BuddyAlloc *buddy, long long int num_page);
+
+// Return if a free block of a number of pages can be allocated
+int can_alloc_block(BuddyAlloc *buddy, long long int block_page);
+
+// Allocate a block of a number of pages and return its start page
+long long int alloc_block(BuddyAlloc *buddy, long long int block_page);
+
+// Free a block from its start page, joining it with its free buddies
+void free_block(BuddyAlloc *buddy, long long int start);
+
+// Return the number of times a block is split
+long long int get_num_split(BuddyAlloc *buddy);
+
+// Return the number of times a block is joined with its buddy
+long long int get_num_merge(BuddyAlloc *buddy);
+
+#endif
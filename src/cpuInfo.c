@@ -2,8 +2,8 @@
  * @file      cpuInfo.c
  * @author    Erya Wen (eryaw@student.unimelb.edu.au)
  * @brief     Implementation of CPU related information module. It includes
- *              1. creating a new CPU data and Memory data
- *              2. destory and free a CPU data and Memory data
+ *              1. creating a new CPU data, Core data and Memory data
+ *              2. destory and free a CPU data, Core data and Memory data
  *
  * @copyright created for COMP30023 Computer System 2020
  *
@@ -13,6 +13,7 @@
 #include "utilities.h"
 
 #include <assert.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -40,8 +41,27 @@ CPUInfo *new_CPUInfo() {
     cpu->total_turnaround = INITIAL;
     cpu->time_overh = INITIAL;
     cpu->max_time_overh= INITIAL;
+    cpu->total_load_time = INITIAL;
+    cpu->total_exe_time = INITIAL;
     cpu->quantam = INITIAL;
     cpu->memory = NULL;
+    cpu->oracle = NULL;
+    cpu->is_quiet = 0;
+    cpu->io = NULL;
+    cpu->num_core = 1;
+    cpu->core_lst = NULL;
+    cpu->num_steal = INITIAL;
+    cpu->speed_lst = NULL;
+    cpu->core_place = ID_G_FLAG;
+    cpu->total_job_time = INITIAL;
+    cpu->num_arrive = INITIAL;
+    cpu->level_quantam = NULL;
+    cpu->num_level = INITIAL;
+    cpu->boost_period = INVALID;
+    cpu->next_boost = INVALID;
+    cpu->num_boost = INITIAL;
+    cpu->target_latency = INVALID;
+    cpu->min_vruntime = INITIAL;
 
     return cpu;
 }
@@ -60,6 +80,17 @@ void free_CPUInfo(CPUInfo *cpu) {
     // Free the memory associated with a CPUInfo
     free_MemoryInfo(cpu->memory);
     cpu->memory = NULL;
+    if (cpu->io != NULL) {
+        free_IODevice(cpu->io);
+        cpu->io = NULL;
+    }
+    if (cpu->core_lst != NULL) {
+        for (long long int i = 0; i < cpu->num_core; i++){
+            free_CoreInfo(cpu->core_lst[i]);
+        }
+        free(cpu->core_lst);
+        cpu->core_lst = NULL;
+    }
 
     // Free the CPUInfo data itself
     free(cpu);
@@ -68,11 +99,72 @@ void free_CPUInfo(CPUInfo *cpu) {
 
 
 /**
- * @brief  Create a new MemoryInfo data
+ * @brief  Create a new CoreInfo data with an empty run queue ordered by 
+ *         a priority
  * 
- * @return      return a pointer to the new MemoryInfo data
+ * @param  core_id      the core id
+ * @param  speed        the speed, a percentage of the base speed
+ * @param  prio         the priority the run queue is ordered by
+ * @return CoreInfo*    return a pointer to the new CoreInfo data
  */
-MemoryInfo *new_MemoryInfo(long long int size) {
+CoreInfo *new_CoreInfo(long long int core_id, long long int speed, 
+                        QueuePrio prio) {
+
+    CoreInfo *core = (CoreInfo *)malloc(sizeof *core);
+    if (core == NULL) {
+        fprintf(stderr, "Error: new_CoreInfo() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Initalise value of the CoreInfo data
+    core->core_id = core_id;
+    core->speed = speed;
+    core->curr_time = INITIAL;
+    core->running = NULL;
+    core->run_queue = new_queue(prio);
+    core->exe_time = INITIAL;
+    core->min_vruntime = INITIAL;
+
+    return core;
+}
+
+
+/**
+ * @brief  Destroy and free the memory associated with a CoreInfo data, 
+ *         the processes in its run queue are not freed
+ * 
+ * @param  core     a CoreInfo data
+ */
+void free_CoreInfo(CoreInfo *core) {
+
+    // Error if the CoreInfo does not initalise
+    assert(core != NULL);
+
+    free_queue(core->run_queue);
+    core->run_queue = NULL;
+
+    // Free the CoreInfo data itself
+    free(core);
+    core = NULL;
+}
+
+
+/**
+ * @brief  Create a new MemoryInfo data of a number of pages for the 
+ *         processes of an arena, each page records the arena index of the 
+ *         process occupying it
+ * 
+ * @param  size     number of pages
+ * @param  arena    the ProcessArena data of the processes
+ * @return          return a pointer to the new MemoryInfo data
+ */
+MemoryInfo *new_MemoryInfo(long long int size, ProcessArena *arena) {
+
+    // Error if the arena index of a process does not fit in the owner table
+    if (arena->capacity > INT_MAX) {
+        fprintf(stderr, "Error: new_MemoryInfo() too many processes\n");
+        exit(EXIT_FAILURE);
+    }
 
     MemoryInfo *memory = (MemoryInfo *)malloc(sizeof *memory);
     if (memory == NULL) {
@@ -84,16 +176,87 @@ MemoryInfo *new_MemoryInfo(long long int size) {
     memory->memory_use = INITIAL;
     memory->total_page = size;
     memory->num_holes = size;
+    memory->evict_index = NULL;
+    memory->holes = new_ExtentTree(size);
+    memory->placement = NULL_CHAR;
+    memory->next_fit = INITIAL;
+    memory->num_frag_sample = INITIAL;
+    memory->total_hole_count = INITIAL;
+    memory->max_hole_count = INITIAL;
+    memory->total_largest_hole = INITIAL;
+    memory->min_largest_hole = size;
+    memory->num_page_load = INITIAL;
+    memory->num_page_io = INITIAL;
+    memory->prefetch_page = INITIAL;
+    memory->prefetch_proc = INITIAL;
+    memory->num_prefetch = INITIAL;
+    memory->num_prefetch_waste = INITIAL;
+    memory->page_size = KB_PAGES;
+    memory->huge_ratio = 1;
+    memory->num_evict = INITIAL;
+    memory->is_page_stat = 0;
+    memory->tier = NULL;
+    memory->swap = NULL;
+    memory->is_share = 0;
+    memory->cow_percent = INITIAL;
+    memory->num_share_load = INITIAL;
+    memory->num_cow_break = INITIAL;
+    memory->clock_hand = INITIAL;
+    memory->adapt = NULL;
+    memory->load_ctrl = NULL;
+    memory->buddy = NULL;
+    memory->total_block_page = INITIAL;
+    memory->total_use_page = INITIAL;
 
-    // Initalise value of the page list 
-    memory->is_occupy_lst = (long long int *)malloc(size * (sizeof(long long int)));
-    if (memory->is_occupy_lst == NULL) {
+    // Initalise the process occupying and the reference bit of each page
+    memory->processes = arena->processes;
+    memory->owner_lst = (int *)malloc(size * (sizeof(int)));
+    memory->ref_bit = (char *)malloc(size * (sizeof(char)));
+    if (memory->owner_lst == NULL || memory->ref_bit == NULL) {
         fprintf(stderr, 
-            "Error: new_MemoryInfo() malloc of is_occupy_lst returned NULL\n");
+            "Error: new_MemoryInfo() malloc of owner_lst returned NULL\n");
         exit(EXIT_FAILURE);
     }
     for (long long int i = 0; i < size; i++){
-        memory->is_occupy_lst[i] = INVALID; 
+        memory->owner_lst[i] = INVALID; 
+        memory->ref_bit[i] = 0;
+    }
+
+    // Initalise the list of pages allocated by the last allocation
+    memory->claim_list = (long long int *)malloc(size * (sizeof(long long int)));
+    if (memory->claim_list == NULL) {
+        fprintf(stderr, 
+            "Error: new_MemoryInfo() malloc of claim_list returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Initalise the list of pages evicted but not printed yet
+    memory->evict_list = (long long int *)malloc(size * (sizeof(long long int)));
+    if (memory->evict_list == NULL) {
+        fprintf(stderr, 
+            "Error: new_MemoryInfo() malloc of evict_list returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+    memory->num_evict_list = INITIAL;
+
+    /**
+     * Initalise the free page bitmap, all pages are empty at the start. 
+     * The bits after the last page in the last word are never set
+     */
+    memory->num_words = (size + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    memory->free_map = (unsigned long long int *)malloc(
+                        memory->num_words * sizeof(unsigned long long int));
+    if (memory->free_map == NULL) {
+        fprintf(stderr, 
+            "Error: new_MemoryInfo() malloc of free_map returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+    for (long long int i = 0; i < memory->num_words; i++){
+        memory->free_map[i] = ~0ULL;
+    }
+    if (size % BITS_PER_WORD != 0){
+        memory->free_map[memory->num_words - 1] = 
+                                    (1ULL << (size % BITS_PER_WORD)) - 1;
     }
 
     return memory;
@@ -111,8 +274,42 @@ void free_MemoryInfo(MemoryInfo *memory) {
     assert(memory!= NULL);
 
     // Free the memory associated with a MemoryInfo
-    free(memory->is_occupy_lst);
-    memory->is_occupy_lst = NULL;
+    free(memory->owner_lst);
+    memory->owner_lst = NULL;
+    free(memory->ref_bit);
+    memory->ref_bit = NULL;
+    free(memory->free_map);
+    memory->free_map = NULL;
+    free(memory->claim_list);
+    memory->claim_list = NULL;
+    free(memory->evict_list);
+    memory->evict_list = NULL;
+    free_ExtentTree(memory->holes);
+    memory->holes = NULL;
+    if (memory->tier != NULL) {
+        free_MemTier(memory->tier);
+        memory->tier = NULL;
+    }
+    if (memory->swap != NULL) {
+        free_SwapDevice(memory->swap);
+        memory->swap = NULL;
+    }
+    if (memory->load_ctrl != NULL) {
+        free_LoadCtrl(memory->load_ctrl);
+        memory->load_ctrl = NULL;
+    }
+    if (memory->adapt != NULL) {
+        free_AdaptRepl(memory->adapt);
+        memory->adapt = NULL;
+    }
+    if (memory->buddy != NULL) {
+        free_BuddyAlloc(memory->buddy);
+        memory->buddy = NULL;
+    }
+    if (memory->evict_index != NULL) {
+        free_queue(memory->evict_index);
+        memory->evict_index = NULL;
+    }
 
     // Free the MemoryInfo data itself
     free(memory);
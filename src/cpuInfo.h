@@ -2,8 +2,8 @@
  * @file      cpuInfo.h
  * @author    Erya Wen (eryaw@student.unimelb.edu.au)
  * @brief     CPU related information module. It includes
- *              1. creating a new CPU data and Memory data
- *              2. destory and free a CPU data and Memory data
+ *              1. creating a new CPU data, Core data and Memory data
+ *              2. destory and free a CPU data, Core data and Memory data
  *
  * @copyright created for COMP30023 Computer System 2020
  *
@@ -13,6 +13,14 @@
 #define CPUINFO_H
 
 #include "queue.h"
+#include "extentTree.h"
+#include "buddyAlloc.h"
+#include "adaptRepl.h"
+#include "oracle.h"
+#include "loadCtrl.h"
+#include "ioDevice.h"
+#include "memTier.h"
+#include "swapDevice.h"
 
 
 // ============================================================================
@@ -21,22 +29,134 @@
 typedef struct memory MemoryInfo;
 /**
  * @brief The MemoryInfo include number of total memory pages, number of holes,
- *        current memory use, and memory page list 
- *        occupied information (record page currently occupied by which process). 
+ *        current memory use, the processes of the arena and the owner table 
+ *        (the arena index of the process occupying each page, 4 bytes per 
+ *        page), a free page bitmap (a set bit is an empty page, 64 pages per
+ *        word) and its number of words, a list of pages allocated by the last
+ *        allocation, a list of pages evicted but not printed yet and its 
+ *        size (all pages evicted for one allocation or finish are printed 
+ *        together), and an eviction index of the processes 
+ *        which are not running but have pages in memory, 
+ *        ordered by the page replacement method.
+ *        It also includes an extent tree of the holes (ranges of empty pages),
+ *        the contiguous placement method and the page next-fit starts from,
+ *        and the hole count and largest hole sampled after each allocation
+ *        for fragmentation statistics, the number of pages loaded, and the
+ *        number of pages of the processes being loaded by the I/O device 
+ *        or running on the cores, which can not be evicted.
+ *        For prefetching, it includes the maximum number of pages and of 
+ *        waiting processes to prefetch for, and the number of pages 
+ *        prefetched and of them evicted before the process runs.
+ *        It also includes the page size (in KB), the number of pages in a 
+ *        huge page (1 if huge pages are not used), the number of pages 
+ *        evicted and whether the page size statistics are printed,
+ *        the compressed pool evicted pages are moved into before 
+ *        the disk, and the swap device pages are read from and written to.
+ *        For copy-on-write sharing, it includes whether the processes of a
+ *        share group share pages, the percentage of its shared pages a 
+ *        process writes each time it runs, and the number of shared pages 
+ *        loaded and of pages copied on write.
+ *        For CLOCK page replacement, it includes a reference bit per page 
+ *        and the page the clock hand is at.
+ *        For ARC and LIRS page replacement, it includes the adaptive 
+ *        page replacement which chooses processes to evict.
+ *        For working-set page replacement, it includes the load control of 
+ *        the recent page faults.
+ *        For buddy allocation, it includes the buddy allocator, and the 
+ *        total pages of the blocks allocated and of them used by processes
+ *        for internal fragmentation statistics.
  */
 struct memory {
     long long int total_page;
     long long int num_holes;
     int memory_use;
-    long long int *is_occupy_lst;
+    ProcessInfo *processes;
+    int *owner_lst;
+    unsigned long long int *free_map;
+    long long int num_words;
+    long long int *claim_list;
+    long long int *evict_list;
+    long long int num_evict_list;
+    Queue *evict_index;
+
+    ExtentTree *holes;
+    char placement;
+    long long int next_fit;
+    long long int num_frag_sample;
+    long long int total_hole_count;
+    long long int max_hole_count;
+    long long int total_largest_hole;
+    long long int min_largest_hole;
+    long long int num_page_load;
+    long long int num_page_io;
+
+    long long int prefetch_page;
+    long long int prefetch_proc;
+    long long int num_prefetch;
+    long long int num_prefetch_waste;
+
+    long long int page_size;
+    long long int huge_ratio;
+    long long int num_evict;
+    int is_page_stat;
+    MemTier *tier;
+    SwapDevice *swap;
+
+    int is_share;
+    long long int cow_percent;
+    long long int num_share_load;
+    long long int num_cow_break;
+
+    char *ref_bit;
+    long long int clock_hand;
+
+    AdaptRepl *adapt;
+    LoadCtrl *load_ctrl;
+
+    BuddyAlloc *buddy;
+    long long int total_block_page;
+    long long int total_use_page;
+};
+
+typedef struct core CoreInfo;
+/**
+ * @brief The CoreInfo include the core id, its speed (percentage of the 
+ *        base speed), the time the core is free, the process running on it 
+ *        and its run queue of processes waiting to run on it, ordered by 
+ *        the scheduling algorithm, and the time it executes processes for 
+ *        statistics. For completely fair scheduling, it includes the 
+ *        smallest virtual runtime of the processes waiting on it.
+ */
+struct core {
+    long long int core_id;
+    long long int speed;
+    long long int curr_time;
+    ProcessInfo *running;
+    Queue *run_queue;
+    long long int exe_time;
+    long long int min_vruntime;
 };
 
 typedef struct cpu CPUInfo;
 /**
  * @brief The CPUInfo include quantam, number of process is current finished, 
  *        current running time, memory information
- *        and turnaround, time overhead, current maximum time overhead 
- *        for statistics usage.
+ *        and turnaround, time overhead, current maximum time overhead, 
+ *        total loading time and total execution time for statistics usage,
+ *        the oracle of the order processes run, whether the execution 
+ *        transcript is printed, and the I/O device loading pages while 
+ *        processes execute.
+ *        For multi-core simulation, it includes the number of cores, the 
+ *        cores and the number of processes stolen by idle cores, the speed 
+ *        of each core (NULL if they all run at the base speed), how 
+ *        processes are placed on the cores, and the total job time and the
+ *        number of the processes arrived.
+ *        For multi-level feedback queue scheduling, it includes the 
+ *        quantum of each level (NULL for other scheduling algorithms) and 
+ *        the number of levels, the period of priority boost, when the 
+ *        next boost is and the number of boosts.
+ *        For completely fair scheduling, it includes the target latency 
+ *        and the smallest virtual runtime of the waiting processes.
  */
 struct cpu {
     long long int complete_num_process;
@@ -44,8 +164,30 @@ struct cpu {
     long long int total_turnaround;
     long double time_overh;
     long double max_time_overh;
+    long long int total_load_time;
+    long long int total_exe_time;
     long long int quantam;
     MemoryInfo *memory;
+    Oracle *oracle;
+    int is_quiet;
+    IODevice *io;
+
+    long long int num_core;
+    CoreInfo **core_lst;
+    long long int num_steal;
+    long long int *speed_lst;
+    char core_place;
+    long long int total_job_time;
+    long long int num_arrive;
+
+    long long int *level_quantam;
+    long long int num_level;
+    long long int boost_period;
+    long long int next_boost;
+    long long int num_boost;
+
+    long long int target_latency;
+    long long int min_vruntime;
 };
 
 
@@ -58,8 +200,15 @@ CPUInfo *new_CPUInfo();
 // Destroy and free the memory associated with a CPUInfo data
 void free_CPUInfo(CPUInfo *p);
 
-// Create a new MemoryInfo data
-MemoryInfo *new_MemoryInfo(long long int size);
+// Create a new CoreInfo data with an empty run queue ordered by a priority
+CoreInfo *new_CoreInfo(long long int core_id, long long int speed, 
+                        QueuePrio prio);
+
+// Destroy and free the memory associated with a CoreInfo data
+void free_CoreInfo(CoreInfo *core);
+
+// Create a new MemoryInfo data of a number of pages for the processes of an arena
+MemoryInfo *new_MemoryInfo(long long int size, ProcessArena *arena);
 
 // Destroy and free the memory associated with a MemoryInfo data
 void free_MemoryInfo(MemoryInfo *p);
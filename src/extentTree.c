@@ -0,0 +1,572 @@
+/**
+ * @file      extentTree.c
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Implementation of Extent tree module, a set of free ranges 
+ *            (holes) of memory pages. It includes
+ *              1. creating and destroying an extent tree
+ *              2. claiming and freeing a range of pages
+ *              3. finding a hole by first-fit, best-fit and next-fit
+ *              4. getting the number of holes and the largest hole
+ *
+ *            Each hole is kept in 2 treaps (randomised balanced binary 
+ *            search trees), so every operation takes O(log n) expected time
+ *              1. ordered by start page, where each node also records the 
+ *                 largest hole of its subtree (first-fit and next-fit)
+ *              2. ordered by length and then start page (best-fit)
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#include "extentTree.h"
+#include "utilities.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+// ============================================================================
+// == | Constant Definitions 
+// ============================================================================
+#define INITIAL_SEED            2463534242U
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+typedef struct extent Extent;
+/**
+ * @brief  An extent is a hole of pages from start page with a length. 
+ *         It has a random treap priority, its children ordered by 
+ *         start page and the largest hole of that subtree, 
+ *         and its children ordered by length
+ */
+struct extent {
+    long long int start;
+    long long int length;
+    unsigned int priority;
+
+    Extent *left;
+    Extent *right;
+    long long int max_length;
+
+    Extent *len_left;
+    Extent *len_right;
+};
+
+
+/**
+ * @brief  An extent tree records the roots of the treap ordered by start page
+ *         and the treap ordered by length, the number of holes, 
+ *         and the seed for the random treap priority
+ */
+struct extent_tree {
+    Extent *by_start;
+    Extent *by_length;
+    long long int num_extent;
+    unsigned int seed;
+};
+
+
+// ============================================================================
+// == | Function Prototypes
+// ============================================================================
+// Add a hole to an ExtentTree
+void insert_extent(ExtentTree *tree, long long int start, long long int length);
+
+// Remove a hole from an ExtentTree and free it
+void remove_extent(ExtentTree *tree, Extent *extent);
+
+// Find the hole with the largest start page not after a page
+Extent *find_extent_before(ExtentTree *tree, long long int page);
+
+// Find the lowest start hole from a page which can fit a length in a subtree
+Extent *find_fit_from(Extent *node, long long int length, long long int from);
+
+// Update the largest hole of a subtree ordered by start page
+void update_max_length(Extent *node);
+
+// Split a treap ordered by start page into holes before and from a page
+void split_start(Extent *node, long long int start, 
+                    Extent **before, Extent **after);
+
+// Join 2 treaps ordered by start page, all holes in before are before after
+Extent *merge_start(Extent *before, Extent *after);
+
+// Split a treap ordered by length into holes before and from a length, start
+void split_length(Extent *node, long long int length, long long int start, 
+                    Extent **before, Extent **after);
+
+// Join 2 treaps ordered by length, all holes in before are before after
+Extent *merge_length(Extent *before, Extent *after);
+
+// Free all holes of a treap ordered by start page
+void free_extents(Extent *node);
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+/**
+ * @brief  Create a new ExtentTree with one hole of all pages
+ * 
+ * @param  total_page   number of pages in memory
+ * @return              the pointer of new ExtentTree
+ */
+ExtentTree *new_ExtentTree(long long int total_page) {
+
+    ExtentTree *tree = (ExtentTree *)malloc(sizeof *tree);
+    if (tree == NULL) {
+        fprintf(stderr, "Error: new_ExtentTree() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Initalise value of the ExtentTree, all pages are empty at the start
+    tree->by_start = NULL;
+    tree->by_length = NULL;
+    tree->num_extent = INITIAL;
+    tree->seed = INITIAL_SEED;
+    if (total_page > 0) {
+        insert_extent(tree, 0, total_page);
+    }
+
+    return tree;
+}
+
+
+/**
+ * @brief  Destroy and free the memory associated with an ExtentTree
+ * 
+ * @param  tree     an ExtentTree
+ */
+void free_ExtentTree(ExtentTree *tree) {
+
+    // Error if the ExtentTree does not initalise
+    assert(tree != NULL);
+
+    free_extents(tree->by_start);
+    tree->by_start = NULL;
+    tree->by_length = NULL;
+
+    free(tree);
+    tree = NULL;
+}
+
+
+/**
+ * @brief  Remove a range of empty pages from the holes. 
+ *         The range must be inside one hole
+ * 
+ * @param  tree     an ExtentTree
+ * @param  start    the start page of the range
+ * @param  length   the number of pages of the range
+ */
+void claim_extent(ExtentTree *tree, long long int start, long long int length) {
+
+    Extent *extent = find_extent_before(tree, start);
+
+    // Error if the range is not inside a hole
+    assert(extent != NULL);
+    assert(extent->start + extent->length >= start + length);
+
+    // Keep the pages of the hole before and after the range
+    long long int hole_start = extent->start;
+    long long int hole_end = extent->start + extent->length;
+    remove_extent(tree, extent);
+
+    if (start > hole_start) {
+        insert_extent(tree, hole_start, start - hole_start);
+    }
+    if (hole_end > start + length) {
+        insert_extent(tree, start + length, hole_end - start - length);
+    }
+}
+
+
+/**
+ * @brief  Add a range of pages to the holes, joining the holes 
+ *         right before and right after it
+ * 
+ * @param  tree     an ExtentTree
+ * @param  start    the start page of the range
+ * @param  length   the number of pages of the range
+ */
+void free_extent(ExtentTree *tree, long long int start, long long int length) {
+
+    // Join the hole which ends right before the range
+    if (start > 0) {
+        Extent *before = find_extent_before(tree, start - 1);
+        if (before != NULL && before->start + before->length == start) {
+            start = before->start;
+            length += before->length;
+            remove_extent(tree, before);
+        }
+    }
+
+    // Join the hole which starts right after the range
+    Extent *after = find_extent_before(tree, start + length);
+    if (after != NULL && after->start == start + length) {
+        length += after->length;
+        remove_extent(tree, after);
+    }
+
+    insert_extent(tree, start, length);
+}
+
+
+/**
+ * @brief  Get the start of the lowest address hole which can fit a length
+ * 
+ * @param  tree             an ExtentTree
+ * @param  length           number of pages
+ * @return long long int    the start page of the hole, 
+ *                          INVALID (-1) if no hole can fit it
+ */
+long long int find_first_fit(ExtentTree *tree, long long int length) {
+    return find_next_fit(tree, length, 0);
+}
+
+
+/**
+ * @brief  Get the start of the smallest hole which can fit a length, 
+ *         the lowest address one if there are more than one
+ * 
+ * @param  tree             an ExtentTree
+ * @param  length           number of pages
+ * @return long long int    the start page of the hole, 
+ *                          INVALID (-1) if no hole can fit it
+ */
+long long int find_best_fit(ExtentTree *tree, long long int length) {
+
+    Extent *best = NULL;
+    Extent *node = tree->by_length;
+    while (node != NULL) {
+        if (node->length >= length) {
+            best = node;
+            node = node->len_left;
+        } else {
+            node = node->len_right;
+        }
+    }
+
+    if (best == NULL) {
+        return INVALID;
+    }
+    return best->start;
+}
+
+
+/**
+ * @brief  Get the start of the first hole which starts from a page and 
+ *         can fit a length. If there is not, search from the first page
+ * 
+ * @param  tree             an ExtentTree
+ * @param  length           number of pages
+ * @param  from             the page where the search starts
+ * @return long long int    the start page of the hole, 
+ *                          INVALID (-1) if no hole can fit it
+ */
+long long int find_next_fit(ExtentTree *tree, long long int length, 
+                            long long int from) {
+    
+    Extent *extent = find_fit_from(tree->by_start, length, from);
+    if (extent == NULL && from > 0) {
+        extent = find_fit_from(tree->by_start, length, 0);
+    }
+
+    if (extent == NULL) {
+        return INVALID;
+    }
+    return extent->start;
+}
+
+
+/**
+ * @brief  Get the number of holes
+ * 
+ * @param  tree             an ExtentTree
+ * @return long long int    the number of holes
+ */
+long long int get_num_extent(ExtentTree *tree) {
+    return tree->num_extent;
+}
+
+
+/**
+ * @brief  Get the number of pages of the largest hole
+ * 
+ * @param  tree             an ExtentTree
+ * @return long long int    the number of pages of the largest hole
+ */
+long long int get_largest_extent(ExtentTree *tree) {
+    if (tree->by_start == NULL) {
+        return 0;
+    }
+    return tree->by_start->max_length;
+}
+
+
+// ============================================================================
+// == | Auxillary Functions 
+// ============================================================================
+/**
+ * @brief  Add a hole to an ExtentTree
+ * 
+ * @param  tree     an ExtentTree
+ * @param  start    the start page of the hole
+ * @param  length   the number of pages of the hole
+ */
+void insert_extent(ExtentTree *tree, long long int start, long long int length){
+
+    Extent *extent = (Extent *)malloc(sizeof *extent);
+    if (extent == NULL) {
+        fprintf(stderr, "Error: insert_extent() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Get a random priority by xorshift
+    tree->seed ^= tree->seed << 13;
+    tree->seed ^= tree->seed >> 17;
+    tree->seed ^= tree->seed << 5;
+
+    extent->start = start;
+    extent->length = length;
+    extent->priority = tree->seed;
+    extent->left = NULL;
+    extent->right = NULL;
+    extent->max_length = length;
+    extent->len_left = NULL;
+    extent->len_right = NULL;
+
+    // Put the hole between the holes before and after it in both treaps
+    Extent *before;
+    Extent *after;
+    split_start(tree->by_start, start, &before, &after);
+    tree->by_start = merge_start(merge_start(before, extent), after);
+
+    split_length(tree->by_length, length, start, &before, &after);
+    tree->by_length = merge_length(merge_length(before, extent), after);
+
+    tree->num_extent++;
+}
+
+
+/**
+ * @brief  Remove a hole from an ExtentTree and free it
+ * 
+ * @param  tree     an ExtentTree
+ * @param  extent   a hole in the ExtentTree
+ */
+void remove_extent(ExtentTree *tree, Extent *extent){
+    Extent *before;
+    Extent *middle;
+    Extent *after;
+
+    // Cut the hole out of both treaps and join the rest
+    split_start(tree->by_start, extent->start, &before, &middle);
+    split_start(middle, extent->start + 1, &middle, &after);
+    assert(middle == extent);
+    tree->by_start = merge_start(before, after);
+
+    split_length(tree->by_length, extent->length, extent->start, 
+                    &before, &middle);
+    split_length(middle, extent->length, extent->start + 1, &middle, &after);
+    assert(middle == extent);
+    tree->by_length = merge_length(before, after);
+
+    free(extent);
+    tree->num_extent--;
+}
+
+
+/**
+ * @brief  Find the hole with the largest start page not after a page
+ * 
+ * @param  tree     an ExtentTree
+ * @param  page     a page
+ * @return Extent*  the hole, NULL if all holes start after the page
+ */
+Extent *find_extent_before(ExtentTree *tree, long long int page){
+    Extent *found = NULL;
+    Extent *node = tree->by_start;
+
+    while (node != NULL) {
+        if (node->start <= page) {
+            found = node;
+            node = node->right;
+        } else {
+            node = node->left;
+        }
+    }
+    return found;
+}
+
+
+/**
+ * @brief  Find the lowest start hole which starts from a page 
+ *         and can fit a length in a subtree ordered by start page. 
+ *         Subtrees without a large enough hole are skipped
+ * 
+ * @param  node     the root of a subtree
+ * @param  length   number of pages
+ * @param  from     a page
+ * @return Extent*  the hole, NULL if no hole can fit it
+ */
+Extent *find_fit_from(Extent *node, long long int length, long long int from){
+    if (node == NULL || node->max_length < length) {
+        return NULL;
+    }
+
+    // Holes in the left subtree start before this hole
+    if (node->start >= from) {
+        Extent *found = find_fit_from(node->left, length, from);
+        if (found != NULL) {
+            return found;
+        }
+        if (node->length >= length) {
+            return node;
+        }
+    }
+    return find_fit_from(node->right, length, from);
+}
+
+
+/**
+ * @brief  Update the largest hole of a subtree ordered by start page
+ * 
+ * @param  node     the root of a subtree
+ */
+void update_max_length(Extent *node){
+    node->max_length = node->length;
+    if (node->left != NULL && node->left->max_length > node->max_length) {
+        node->max_length = node->left->max_length;
+    }
+    if (node->right != NULL && node->right->max_length > node->max_length) {
+        node->max_length = node->right->max_length;
+    }
+}
+
+
+/**
+ * @brief  Split a treap ordered by start page into holes which start 
+ *         before a page and holes which start from the page
+ * 
+ * @param  node     the root of a treap
+ * @param  start    a page
+ * @param  before   the treap of holes start before the page
+ * @param  after    the treap of holes start from the page
+ */
+void split_start(Extent *node, long long int start, 
+                    Extent **before, Extent **after){
+    if (node == NULL) {
+        *before = NULL;
+        *after = NULL;
+        return;
+    }
+
+    if (node->start < start) {
+        split_start(node->right, start, &node->right, after);
+        *before = node;
+    } else {
+        split_start(node->left, start, before, &node->left);
+        *after = node;
+    }
+    update_max_length(node);
+}
+
+
+/**
+ * @brief  Join 2 treaps ordered by start page, 
+ *         all holes in before start before the holes in after
+ * 
+ * @param  before   a treap
+ * @param  after    a treap
+ * @return Extent*  the root of the joined treap
+ */
+Extent *merge_start(Extent *before, Extent *after){
+    if (before == NULL) {
+        return after;
+    }
+    if (after == NULL) {
+        return before;
+    }
+
+    if (before->priority > after->priority) {
+        before->right = merge_start(before->right, after);
+        update_max_length(before);
+        return before;
+    }
+    after->left = merge_start(before, after->left);
+    update_max_length(after);
+    return after;
+}
+
+
+/**
+ * @brief  Split a treap ordered by length and then start page into holes 
+ *         before a length and start page, and the rest holes
+ * 
+ * @param  node     the root of a treap
+ * @param  length   a length
+ * @param  start    a page
+ * @param  before   the treap of holes before the length and start page
+ * @param  after    the treap of the rest holes
+ */
+void split_length(Extent *node, long long int length, long long int start, 
+                    Extent **before, Extent **after){
+    if (node == NULL) {
+        *before = NULL;
+        *after = NULL;
+        return;
+    }
+
+    if (node->length < length 
+        || (node->length == length && node->start < start)) {
+        split_length(node->len_right, length, start, &node->len_right, after);
+        *before = node;
+    } else {
+        split_length(node->len_left, length, start, before, &node->len_left);
+        *after = node;
+    }
+}
+
+
+/**
+ * @brief  Join 2 treaps ordered by length and then start page, 
+ *         all holes in before are before the holes in after
+ * 
+ * @param  before   a treap
+ * @param  after    a treap
+ * @return Extent*  the root of the joined treap
+ */
+Extent *merge_length(Extent *before, Extent *after){
+    if (before == NULL) {
+        return after;
+    }
+    if (after == NULL) {
+        return before;
+    }
+
+    if (before->priority > after->priority) {
+        before->len_right = merge_length(before->len_right, after);
+        return before;
+    }
+    after->len_left = merge_length(before, after->len_left);
+    return after;
+}
+
+
+/**
+ * @brief  Free all holes of a treap ordered by start page
+ * 
+ * @param  node     the root of a treap
+ */
+void free_extents(Extent *node){
+    if (node == NULL) {
+        return;
+    }
+    free_extents(node->left);
+    free_extents(node->right);
+    free(node);
+}
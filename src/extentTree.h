@@ -0,0 +1,56 @@
+/**
+ * @file      extentTree.h
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Extent tree module, a set of free ranges (holes) of memory pages.
+ *            It includes
+ *              1. creating and destroying an extent tree
+ *              2. claiming and freeing a range of pages
+ *              3. finding a hole by first-fit, best-fit and next-fit
+ *              4. getting the number of holes and the largest hole
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#ifndef EXTENTTREE_H
+#define EXTENTTREE_H
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+typedef struct extent_tree ExtentTree;
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+// Create a new ExtentTree with one hole of all pages
+ExtentTree *new_ExtentTree(long long int total_page);
+
+// Destroy and free the memory associated with an ExtentTree
+void free_ExtentTree(ExtentTree *tree);
+
+// Remove a range of empty pages from the holes
+void claim_extent(ExtentTree *tree, long long int start, long long int length);
+
+// Add a range of pages to the holes, joining the holes next to it
+void free_extent(ExtentTree *tree, long long int start, long long int length);
+
+// Return the start of the lowest address hole which can fit a length
+long long int find_first_fit(ExtentTree *tree, long long int length);
+
+// Return the start of the smallest hole which can fit a length
+long long int find_best_fit(ExtentTree *tree, long long int length);
+
+// Return the start of the first hole from a page which can fit a length
+long long int find_next_fit(ExtentTree *tree, long long int length, 
+                            long long int from);
+
+// Return the number of holes
+long long int get_num_extent(ExtentTree *tree);
+
+// Return the number of pages of the largest hole
+long long int get_largest_extent(ExtentTree *tree);
+
+#endif
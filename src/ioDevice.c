@@ -0,0 +1,160 @@
+/**
+ * @file      ioDevice.c
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Implementation of I/O device module, a DMA device which loads 
+ *            pages while the CPU executes other processes. It includes
+ *              1. creating and destroying an I/O device
+ *              2. issuing and completing page loads in first-in-first-out
+ *                 order
+ *              3. recording the I/O queue depth for statistics
+ *
+ *            The device loads one process at a time, so a page load starts
+ *            when it is issued or when the page load before it finishes
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#include "ioDevice.h"
+#include "utilities.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+/**
+ * @brief  An I/O device records when it finishes all page loads issued, 
+ *         the number of page loads not finished, and the number of page 
+ *         loads issued, the total and maximum I/O queue depth when a page
+ *         load is issued for statistics
+ */
+struct io_device {
+    long long int free_time;
+    long long int num_pending;
+
+    long long int num_io;
+    long long int total_depth;
+    long long int max_depth;
+};
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+/**
+ * @brief  Create a new IODevice which is idle
+ * 
+ * @return IODevice*    return a pointer to the new IODevice
+ */
+IODevice *new_IODevice(){
+
+    IODevice *io = (IODevice *)malloc(sizeof *io);
+    if (io == NULL) {
+        fprintf(stderr, "Error: new_IODevice() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Initalise value of the IODevice
+    io->free_time = INITIAL;
+    io->num_pending = INITIAL;
+    io->num_io = INITIAL;
+    io->total_depth = INITIAL;
+    io->max_depth = INITIAL;
+
+    return io;
+}
+
+
+/**
+ * @brief  Destroy and free the memory associated with an IODevice
+ * 
+ * @param  io   an IODevice
+ */
+void free_IODevice(IODevice *io){
+
+    // Error if the IODevice does not initalise
+    assert(io != NULL);
+
+    // Free the IODevice itself
+    free(io);
+    io = NULL;
+}
+
+
+/**
+ * @brief  Issue a page load at a time, it starts after all page loads 
+ *         issued before it finish
+ * 
+ * @param  io               an IODevice
+ * @param  time             the time the page load is issued
+ * @param  load_time        the time to load the pages
+ * @return long long int    the time the page load finishes
+ */
+long long int issue_io(IODevice *io, long long int time, long long int load_time){
+
+    if (io->free_time < time){
+        io->free_time = time;
+    }
+    io->free_time += load_time;
+
+    // The queue depth includes the page load issued
+    io->num_pending++;
+    io->num_io++;
+    io->total_depth += io->num_pending;
+    if (io->num_pending > io->max_depth){
+        io->max_depth = io->num_pending;
+    }
+
+    return io->free_time;
+}
+
+
+/**
+ * @brief  Record the earliest page load issued finishes
+ * 
+ * @param  io   an IODevice
+ */
+void complete_io(IODevice *io){
+    assert(io->num_pending > 0);
+    io->num_pending--;
+}
+
+
+/**
+ * @brief  Return the number of page loads issued
+ * 
+ * @param  io               an IODevice
+ * @return long long int    number of page loads
+ */
+long long int get_num_io(IODevice *io){
+    return io->num_io;
+}
+
+
+/**
+ * @brief  Return the average I/O queue depth when a page load is issued
+ * 
+ * @param  io       an IODevice
+ * @return double   the average queue depth, 0 if no page load is issued
+ */
+double get_avg_depth(IODevice *io){
+    if (io->num_io == 0){
+        return 0;
+    }
+    return io->total_depth * 1.0 / io->num_io;
+}
+
+
+/**
+ * @brief  Return the maximum I/O queue depth
+ * 
+ * @param  io               an IODevice
+ * @return long long int    the maximum queue depth
+ */
+long long int get_max_depth(IODevice *io){
+    return io->max_depth;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file      ioDevice.h
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     I/O device module, a DMA device which loads pages while the 
+ *            CPU executes other processes. It includes
+ *              1. creating and destroying an I/O device
+ *              2. issuing and completing page loads in first-in-first-out
+ *                 order
+ *              3. recording the I/O queue depth for statistics
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#ifndef IODEVICE_H
+#define IODEVICE_H
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+typedef struct io_device IODevice;
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+// Create a new IODevice which is idle
+IODevice *new_IODevice();
+
+// Destroy and free the memory associated with an IODevice
+void free_IODevice(IODevice *io);
+
+// Issue a page load at a time and return when it finishes
+long long int issue_io(IODevice *io, long long int time, long long int load_time);
+
+// Record the earliest page load issued finishes
+void complete_io(IODevice *io);
+
+// Return the number of page loads issued
+long long int get_num_io(IODevice *io);
+
+// Return the average I/O queue depth when a page load is issued
+double get_avg_depth(IODevice *io);
+
+// Return the maximum I/O queue depth
+long long int get_max_depth(IODevice *io);
+
+#endif
@@ -0,0 +1,250 @@
+/**
+ * @file      loadCtrl.c
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Implementation of Load control module, the page faults in a 
+ *            recent time window for working-set page replacement and 
+ *            thrashing control. It includes
+ *              1. creating and destroying a load control
+ *              2. recording page faults and checking for thrashing
+ *              3. counting processes suspended for statistics
+ *
+ *            The page faults are recorded in a growable ring buffer in time
+ *            order with their total, the faults older than the window are 
+ *            removed from the front, so each record is added and removed 
+ *            once
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#include "loadCtrl.h"
+#include "utilities.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+// ============================================================================
+// == | Constant Definitions 
+// ============================================================================
+#define INITIAL_CAPACITY        64
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+/**
+ * @brief  A load control records the time window, the maximum number of 
+ *         page faults in it, the ring buffer of fault times and numbers of 
+ *         faults with its capacity, the buffer index of the oldest record 
+ *         and the number of records, the total faults of the records, 
+ *         and the number of times a process is suspended
+ */
+struct load_ctrl {
+    long long int window;
+    long long int max_fault;
+
+    long long int *fault_time;
+    long long int *num_fault;
+    long long int capacity;
+    long long int head;
+    long long int size;
+    long long int total_fault;
+
+    long long int num_suspend;
+};
+
+
+// ============================================================================
+// == | Function Prototypes
+// ============================================================================
+// Remove the page faults older than the window before a time
+void expire_fault(LoadCtrl *ctrl, long long int time);
+
+// Make the ring buffer of a LoadCtrl larger when it is full
+void grow_fault(LoadCtrl *ctrl);
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+/**
+ * @brief  Create a new LoadCtrl of a time window and a maximum number of 
+ *         page faults in it
+ * 
+ * @param  window       the time window
+ * @param  max_fault    the maximum number of page faults in the window
+ * @return LoadCtrl*    return a pointer to the new LoadCtrl
+ */
+LoadCtrl *new_LoadCtrl(long long int window, long long int max_fault){
+
+    LoadCtrl *ctrl = (LoadCtrl *)malloc(sizeof *ctrl);
+    if (ctrl == NULL) {
+        fprintf(stderr, "Error: new_LoadCtrl() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Initalise value of the LoadCtrl
+    ctrl->window = window;
+    ctrl->max_fault = max_fault;
+    ctrl->fault_time = (long long int *)malloc(
+                        INITIAL_CAPACITY * sizeof(long long int));
+    ctrl->num_fault = (long long int *)malloc(
+                        INITIAL_CAPACITY * sizeof(long long int));
+    if (ctrl->fault_time == NULL || ctrl->num_fault == NULL) {
+        fprintf(stderr, 
+            "Error: new_LoadCtrl() malloc of fault records returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+    ctrl->capacity = INITIAL_CAPACITY;
+    ctrl->head = INITIAL;
+    ctrl->size = INITIAL;
+    ctrl->total_fault = INITIAL;
+    ctrl->num_suspend = INITIAL;
+
+    return ctrl;
+}
+
+
+/**
+ * @brief  Destroy and free the memory associated with a LoadCtrl
+ * 
+ * @param  ctrl     a LoadCtrl
+ */
+void free_LoadCtrl(LoadCtrl *ctrl){
+
+    // Error if the LoadCtrl does not initalise
+    assert(ctrl != NULL);
+
+    // Free the memory associated with a LoadCtrl
+    free(ctrl->fault_time);
+    free(ctrl->num_fault);
+
+    // Free the LoadCtrl itself
+    free(ctrl);
+    ctrl = NULL;
+}
+
+
+/**
+ * @brief  Return the time window of a LoadCtrl
+ * 
+ * @param  ctrl             a LoadCtrl
+ * @return long long int    the time window
+ */
+long long int get_window(LoadCtrl *ctrl){
+    return ctrl->window;
+}
+
+
+/**
+ * @brief  Record a number of page faults at a time, the time is not 
+ *         before the last record
+ * 
+ * @param  ctrl         a LoadCtrl
+ * @param  time         the time of the page faults
+ * @param  num_fault    number of page faults
+ */
+void record_fault(LoadCtrl *ctrl, long long int time, long long int num_fault){
+
+    if (num_fault <= 0){
+        return;
+    }
+    if (ctrl->size == ctrl->capacity){
+        grow_fault(ctrl);
+    }
+
+    long long int ind = (ctrl->head + ctrl->size) % ctrl->capacity;
+    ctrl->fault_time[ind] = time;
+    ctrl->num_fault[ind] = num_fault;
+    ctrl->size++;
+    ctrl->total_fault += num_fault;
+}
+
+
+/**
+ * @brief  Return if the page faults in the window before a time are more 
+ *         than the maximum
+ * 
+ * @param  ctrl     a LoadCtrl
+ * @param  time     the current time
+ * @return int      1 if thrashing, 0 otherwise
+ */
+int is_thrashing(LoadCtrl *ctrl, long long int time){
+    expire_fault(ctrl, time);
+    return ctrl->total_fault > ctrl->max_fault;
+}
+
+
+/**
+ * @brief  Record a process is suspended
+ * 
+ * @param  ctrl     a LoadCtrl
+ */
+void record_suspend(LoadCtrl *ctrl){
+    ctrl->num_suspend++;
+}
+
+
+/**
+ * @brief  Return the number of times a process is suspended
+ * 
+ * @param  ctrl             a LoadCtrl
+ * @return long long int    number of suspensions
+ */
+long long int get_num_suspend(LoadCtrl *ctrl){
+    return ctrl->num_suspend;
+}
+
+
+// ============================================================================
+// == | Auxillary Functions 
+// ============================================================================
+/**
+ * @brief  Remove the page faults not in the window before a time, 
+ *         i.e. at or before time - window
+ * 
+ * @param  ctrl     a LoadCtrl
+ * @param  time     the current time
+ */
+void expire_fault(LoadCtrl *ctrl, long long int time){
+    while (ctrl->size > 0 
+            && ctrl->fault_time[ctrl->head] <= time - ctrl->window){
+        ctrl->total_fault -= ctrl->num_fault[ctrl->head];
+        ctrl->head = (ctrl->head + 1) % ctrl->capacity;
+        ctrl->size--;
+    }
+}
+
+
+/**
+ * @brief  Double the ring buffer of a LoadCtrl when it is full, the records
+ *         are moved to the start of the new buffer
+ * 
+ * @param  ctrl     a LoadCtrl
+ */
+void grow_fault(LoadCtrl *ctrl){
+
+    long long int capacity = 2 * ctrl->capacity;
+    long long int *fault_time = (long long int *)malloc(
+                                capacity * sizeof(long long int));
+    long long int *num_fault = (long long int *)malloc(
+                                capacity * sizeof(long long int));
+    if (fault_time == NULL || num_fault == NULL) {
+        fprintf(stderr, "Error: grow_fault() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+    for (long long int i = 0; i < ctrl->size; i++){
+        long long int ind = (ctrl->head + i) % ctrl->capacity;
+        fault_time[i] = ctrl->fault_time[ind];
+        num_fault[i] = ctrl->num_fault[ind];
+    }
+
+    free(ctrl->fault_time);
+    free(ctrl->num_fault);
+    ctrl->fault_time = fault_time;
+    ctrl->num_fault = num_fault;
+    ctrl->capacity = capacity;
+    ctrl->head = INITIAL;
+}
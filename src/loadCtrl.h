@@ -0,0 +1,49 @@
+/**
+ * @file      loadCtrl.h
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Load control module, the page faults in a recent time window 
+ *            for working-set page replacement and thrashing control. 
+ *            It includes
+ *              1. creating and destroying a load control
+ *              2. recording page faults and checking for thrashing
+ *              3. counting processes suspended for statistics
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#ifndef LOADCTRL_H
+#define LOADCTRL_H
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+typedef struct load_ctrl LoadCtrl;
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+// Create a new LoadCtrl of a time window and a maximum number of faults in it
+LoadCtrl *new_LoadCtrl(long long int window, long long int max_fault);
+
+// Destroy and free the memory associated with a LoadCtrl
+void free_LoadCtrl(LoadCtrl *ctrl);
+
+// Return the time window of a LoadCtrl
+long long int get_window(LoadCtrl *ctrl);
+
+// Record a number of page faults at a time
+void record_fault(LoadCtrl *ctrl, long long int time, long long int num_fault);
+
+// Return if the page faults in the window before a time are too many
+int is_thrashing(LoadCtrl *ctrl, long long int time);
+
+// Record a process is suspended
+void record_suspend(LoadCtrl *ctrl);
+
+// Return the number of times a process is suspended
+long long int get_num_suspend(LoadCtrl *ctrl);
+
+#endif
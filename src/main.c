@@ -27,17 +27,28 @@
 // ============================================================================
 #define MIN_NUM_ARGUMENT        7
 #define BIN_LEN                 60.0
+#define MAX_LINE_LEN            256
+#define IDLE_POWER_PERCENT      10
 
 
 // ============================================================================
 // == | Function Prototypes
 // ============================================================================
 // Read Processes from file
-void read_file(Queue *queue, char *filename);
+ProcessArena *read_file(Queue *queue, char *filename);
+
+// Count the number of lines in a file
+long long int count_lines(FILE *fp);
+
+// Create a new CPUInfo data with its memory for a memory allocation method
+CPUInfo *init_CPUInfo(ArguInfo *argu, char mem_alloc_f, ProcessArena *arena);
 
 // Print performance statistics
 void print_statistics(CPUInfo *cpu, Queue *complete_queue);
 
+// Run the trace again with the oracle and print the comparison
+void print_oracle(ArguInfo *argu, CPUInfo *cpu);
+
 // Print program usage
 void print_usage(char *prog_name);
 
@@ -73,24 +84,31 @@ int main (int argc, char **argv){
     }
 
     // read the processes from the file
-    Queue *queue = new_queue();
-    CPUInfo *cpu = new_CPUInfo();
-    read_file(queue, argu->filename);
+    Queue *queue = new_queue(PRIO_ARRIVAL_T);
+    ProcessArena *arena = read_file(queue, argu->filename);
+    CPUInfo *cpu = init_CPUInfo(argu, argu->mem_alloc, arena);
 
-    // Initialise the quantum which is fixed and maximum memory size for cpu
-    cpu->quantam = argu->quantum;
-    cpu->memory = new_MemoryInfo(argu->mem_size / KB_PAGES);
+    // Record the order processes run if it is compared with the oracle
+    if (argu->oracle){
+        cpu->oracle = new_Oracle(arena);
+    }
 
     // Simulation the process allocation and memory management
     Queue *complete = simulation(argu->sched_algo, argu->mem_alloc, queue, cpu);
     // Print performance statistics after simulation finished.
     print_statistics(cpu, complete);
+    if (cpu->oracle != NULL){
+        print_oracle(argu, cpu);
+        free_Oracle(cpu->oracle);
+        cpu->oracle = NULL;
+    }
 
     // Free memory allocation
     free_ArguInfo(argu);
     free_queue(queue);
     free_queue(complete);
     free_CPUInfo(cpu);
+    free_ProcessArena(arena);
 
     return 0;
 }
@@ -102,15 +120,19 @@ int main (int argc, char **argv){
 /**
  * @brief Read Processes from file
  * 
- * @param queue     a queue to store processes
- * @param filename  file name
+ * @param queue             a queue to store processes
+ * @param filename          file name
+ * @return ProcessArena*    an arena which all processes are allocated from
  */
-void read_file(Queue *queue, char *filename){
+ProcessArena *read_file(Queue *queue, char *filename){
 
     long long int arrive_time;
     long long int p_id;
     long long int mem_size_req;
     long long int job_time;
+    long long int share_id;
+    long long int nice;
+    char line[MAX_LINE_LEN];
 
     // Open the file in read mode
     FILE *fp = fopen(filename, "r"); 
@@ -119,26 +141,178 @@ void read_file(Queue *queue, char *filename){
         exit(EXIT_FAILURE);
     }
 
+    /**
+     * Allocate all processes at once, one process per line, and a shared 
+     * segment for each share group of at least two processes
+     */
+    long long int num_lines = count_lines(fp);
+    ProcessArena *arena = new_ProcessArena(num_lines + num_lines / 2);
+
     /*
      * Read the process information from the file 
      * The standard file should contain 4 integers per line, which represents
      * process arrival time, process id, memory required for a process
-     * and process job time (in order).
+     * and process job time (in order). An optional 5th integer is the 
+     * share group id of the process (-1 for none), and an optional 6th 
+     * integer is the nice value of the process, from -20 to 19.
      */
-    while(fscanf(fp, "%lld %lld %lld %lld\n", 
-                &arrive_time, &p_id, &mem_size_req, &job_time) != EOF )
+    while(fgets(line, MAX_LINE_LEN, fp) != NULL)
     {
-        ProcessInfo *p = new_ProcessInfo();
+        share_id = INVALID;
+        nice = INITIAL;
+        if (sscanf(line, "%lld %lld %lld %lld %lld %lld", &arrive_time, &p_id,
+                    &mem_size_req, &job_time, &share_id, &nice) < 4){
+            continue;
+        }
+        if (nice < MIN_NICE){
+            nice = MIN_NICE;
+        } else if (nice > MAX_NICE){
+            nice = MAX_NICE;
+        }
+        ProcessInfo *p = new_ProcessInfo(arena);
         p->arrive_time = arrive_time;
         p->p_id = p_id;
         p->mem_size_req = mem_size_req;
         p->job_time = job_time;
         p->remaining_time = job_time;
-        enqueue(queue, p, PRIO_ARRIVAL_T);
+        p->share_id = share_id;
+        p->nice = nice;
+        enqueue(queue, p);
         
     }
+    share_ProcessArena(arena);
 
    fclose(fp);  
+   return arena;
+}
+
+
+/**
+ * @brief Count the number of lines in a file, 
+ *        and move back to the start of the file
+ * 
+ * @param fp                a file
+ * @return long long int    number of lines
+ */
+long long int count_lines(FILE *fp){
+    long long int num_lines = 0;
+    int c;
+    int prev = '\n';
+
+    while ((c = fgetc(fp)) != EOF){
+        if (c == '\n'){
+            num_lines++;
+        }
+        prev = c;
+    }
+
+    // Count the last line if it does not end with a new line
+    if (prev != '\n'){
+        num_lines++;
+    }
+
+    rewind(fp);
+    return num_lines;
+}
+
+
+/**
+ * @brief  Create a new CPUInfo data with the quantum which is fixed, 
+ *         and its memory of the maximum memory size for a memory 
+ *         allocation method
+ * 
+ * @param  argu         a ArguInfo data
+ * @param  mem_alloc_f  a memory allocation method flag
+ * @param  arena        the ProcessArena data of the processes
+ * @return CPUInfo*     return a pointer to the new CPUInfo data
+ */
+CPUInfo *init_CPUInfo(ArguInfo *argu, char mem_alloc_f, ProcessArena *arena){
+
+    CPUInfo *cpu = new_CPUInfo();
+    cpu->quantam = argu->quantum;
+    cpu->num_core = argu->num_core;
+    cpu->speed_lst = argu->speed_lst;
+    cpu->core_place = argu->core_place;
+    cpu->level_quantam = argu->level_quantam;
+    cpu->num_level = argu->num_level;
+    cpu->boost_period = argu->boost_period;
+    cpu->next_boost = argu->boost_period;
+    cpu->target_latency = argu->target_latency;
+
+    // The memory is divided into pages of the page size
+    long long int page_size = KB_PAGES;
+    if (argu->page_size != INVALID){
+        page_size = argu->page_size;
+    }
+    long long int total_page = 0;
+    if (argu->mem_size != INVALID){
+        total_page = argu->mem_size / page_size;
+    }
+
+    /**
+     * The compressed pool takes a part of the memory, and holds the 
+     * compression ratio times of its size of evicted pages
+     */
+    long long int pool_page = 0;
+    if (argu->pool_size != INVALID && mem_alloc_f != UN_M_FLAG){
+        total_page = (argu->mem_size - argu->pool_size) / page_size;
+        pool_page = argu->pool_size * argu->compress_ratio / page_size;
+    }
+    cpu->memory = new_MemoryInfo(total_page, arena);
+    cpu->memory->page_size = page_size;
+    cpu->memory->is_page_stat = argu->page_size != INVALID 
+                                || argu->huge_size != INVALID;
+
+    /**
+     * Huge pages are not used by buddy allocation, which has its own blocks,
+     * and by CLOCK page replacement, which evicts pages one by one. 
+     * A huge page has to fit in the memory
+     */
+    if (argu->huge_size != INVALID && mem_alloc_f != BU_M_FLAG 
+        && mem_alloc_f != CL_M_FLAG 
+        && argu->huge_size / page_size <= total_page){
+        cpu->memory->huge_ratio = argu->huge_size / page_size;
+    }
+    if (pool_page > 0){
+        cpu->memory->tier = new_MemTier(pool_page);
+    }
+    if (argu->seek_time != INVALID && mem_alloc_f != UN_M_FLAG){
+        cpu->memory->swap = new_SwapDevice(argu->seek_time, 
+                                            argu->swap_bandwidth);
+    }
+    cpu->memory->placement = argu->placement;
+    if (argu->async_io){
+        cpu->io = new_IODevice();
+    }
+
+    /**
+     * The processes of a share group share pages copy-on-write for 
+     * Swapping, Virtual Memory and Customised Memory Management, when the 
+     * pages are loaded before the process runs on a single core and are 
+     * not huge pages
+     */
+    if (arena->num_share > 0 && cpu->io == NULL && cpu->num_core == 1
+        && cpu->memory->huge_ratio == 1
+        && (mem_alloc_f == SP_M_FLAG || mem_alloc_f == VM_M_FLAG 
+            || mem_alloc_f == CM_M_FLAG)){
+        cpu->memory->is_share = 1;
+        cpu->memory->cow_percent = argu->cow_percent;
+    }
+    if (mem_alloc_f == VM_M_FLAG && argu->prefetch_page > 0){
+        cpu->memory->prefetch_page = argu->prefetch_page;
+        cpu->memory->prefetch_proc = argu->prefetch_proc;
+    }
+    if (mem_alloc_f == BU_M_FLAG){
+        cpu->memory->buddy = new_BuddyAlloc(cpu->memory->total_page);
+    } else if (mem_alloc_f == AR_M_FLAG || mem_alloc_f == LI_M_FLAG){
+        cpu->memory->adapt = new_AdaptRepl(mem_alloc_f, 
+                                            cpu->memory->total_page);
+    } else if (mem_alloc_f == WS_M_FLAG){
+        cpu->memory->load_ctrl = new_LoadCtrl(argu->ws_window, 
+                cpu->memory->total_page * argu->fault_threshold / 100);
+    }
+
+    return cpu;
 }
 
 
@@ -164,12 +338,19 @@ void print_statistics(CPUInfo *cpu, Queue *complete_queue){
      * Put the completed process in sequential non-overlapping 60 second 
      * intervals, with the first interval starting at 1. 
      */
+    long long int total_page_kb = 0;
+    long long int total_use_kb = 0;
     for(long long int i = 0; i < num_process; i++){
         long long int bin_ind;
         ProcessInfo *p = dequeue(complete_queue);
         bin_ind = (my_ceil(p->complete_time * 1.0 / BIN_LEN)) - 1;
         bin[bin_ind] += 1;
-        free_ProcessInfo(p);
+
+        // Record the memory the pages of a process and the process take
+        if (p->total_require_page != INVALID){
+            total_page_kb += p->total_require_page * cpu->memory->page_size;
+            total_use_kb += p->mem_size_req;
+        }
     }
 
     // Calculate average, maximum and minimum throughput
@@ -205,11 +386,222 @@ void print_statistics(CPUInfo *cpu, Queue *complete_queue){
                     cpu->max_time_overh, avg_time_overh);
     fprintf(stdout, "Makespan %lld\n", cpu->curr_time);
 
+    /**
+     * If a contiguous placement method is chosen, print the average and 
+     * maximum hole count, and the average and minimum largest hole (in pages)
+     * sampled after each allocation
+     */
+    MemoryInfo *memory = cpu->memory;
+    if ((memory->placement != NULL_CHAR || memory->is_page_stat) 
+        && memory->num_frag_sample > 0){
+        fprintf(stdout, "Hole count %lld, %lld\n", 
+                my_ceil(memory->total_hole_count * 1.0 
+                        / memory->num_frag_sample), 
+                memory->max_hole_count);
+        fprintf(stdout, "Largest hole %lld, %lld\n", 
+                my_ceil(memory->total_largest_hole * 1.0 
+                        / memory->num_frag_sample), 
+                memory->min_largest_hole);
+    }
+
+    /**
+     * For buddy allocation, print the internal fragmentation (the percentage 
+     * of pages in the blocks allocated not used by processes), and the 
+     * number of times a block is split and joined
+     */
+    if (memory->buddy != NULL && memory->total_block_page > 0){
+        fprintf(stdout, "Internal fragmentation %lld%%\n", 
+                my_ceil(100.0 * (memory->total_block_page 
+                                    - memory->total_use_page) 
+                        / memory->total_block_page));
+        fprintf(stdout, "Block splits %lld, merges %lld\n", 
+                get_num_split(memory->buddy), get_num_merge(memory->buddy));
+    }
+
+    /**
+     * For ARC and LIRS page replacement, print the number of times a process
+     * runs with all or not all its pages in memory
+     */
+    if (memory->adapt != NULL){
+        fprintf(stdout, "Hits %lld, misses %lld\n", 
+                get_repl_hit(memory->adapt), get_repl_miss(memory->adapt));
+    }
+
+    /**
+     * For working-set page replacement, print the number of times a process
+     * is suspended by the load control
+     */
+    if (memory->load_ctrl != NULL){
+        fprintf(stdout, "Suspensions %lld\n", 
+                get_num_suspend(memory->load_ctrl));
+    }
+
+    /**
+     * For prefetching, print the number of pages prefetched and of them 
+     * evicted before the process runs
+     */
+    if (memory->prefetch_proc > 0){
+        fprintf(stdout, "Prefetched pages %lld, wasted %lld\n", 
+                memory->num_prefetch, memory->num_prefetch_waste);
+    }
+
+    /**
+     * For the compressed pool, print the number of pages loaded from the 
+     * pool and the disk, and written from the pool to the disk
+     */
+    if (memory->tier != NULL){
+        fprintf(stdout, "Pool loads %lld, disk loads %lld, disk writes %lld\n",
+                get_pool_load(memory->tier), get_disk_load(memory->tier), 
+                get_disk_write(memory->tier));
+    }
+
+    /**
+     * For copy-on-write sharing, print the number of shared pages loaded 
+     * and of pages copied when a process writes to them
+     */
+    if (memory->is_share){
+        fprintf(stdout, "Shared page loads %lld, copies on write %lld\n",
+                memory->num_share_load, memory->num_cow_break);
+    }
+
+    /**
+     * For the swap device, print the number of pages read and written, 
+     * and of seeks
+     */
+    if (memory->swap != NULL){
+        fprintf(stdout, "Swap reads %lld, writes %lld, seeks %lld\n",
+                get_swap_read(memory->swap), get_swap_write(memory->swap), 
+                get_swap_seek(memory->swap));
+    }
+
+    /**
+     * For all of them, the page size, the compressed pool and the swap 
+     * device, print the total loading time
+     */
+    if (memory->adapt != NULL || memory->load_ctrl != NULL 
+        || memory->prefetch_proc > 0 || memory->is_page_stat 
+        || memory->tier != NULL || memory->swap != NULL){
+        fprintf(stdout, "Load time %lld\n", cpu->total_load_time);
+    }
+
+    /**
+     * For the page size, print the number of pages evicted (a huge page is
+     * counted once), and the internal fragmentation (the percentage of the
+     * pages allocated not used by processes)
+     */
+    if (memory->is_page_stat){
+        fprintf(stdout, "Evictions %lld\n", memory->num_evict);
+        if (memory->buddy == NULL && total_page_kb > 0){
+            fprintf(stdout, "Internal fragmentation %lld%%\n", 
+                    my_ceil(100.0 * (total_page_kb - total_use_kb) 
+                            / total_page_kb));
+        }
+    }
+
+    /**
+     * If pages are loaded by the I/O device or there are multiple cores, 
+     * print the percentage of time the cores execute processes. Print the 
+     * average and maximum number of page loads waiting for the I/O device 
+     * when one is issued, the number of processes stolen by idle cores, 
+     * and the number of priority boosts of the multi-level feedback queue
+     */
+    if (cpu->io != NULL || cpu->core_lst != NULL){
+        long long int utilisation = 0;
+        if (cpu->curr_time > 0){
+            utilisation = my_ceil(100.0 * cpu->total_exe_time 
+                                    / (cpu->curr_time * cpu->num_core));
+        }
+        fprintf(stdout, "CPU utilisation %lld%%\n", utilisation);
+    }
+    if (cpu->io != NULL){
+        fprintf(stdout, "I/O queue depth %.2f %lld\n", 
+                get_avg_depth(cpu->io), get_max_depth(cpu->io));
+    }
+    if (cpu->core_lst != NULL){
+        fprintf(stdout, "Cores %lld, work steals %lld\n", 
+                cpu->num_core, cpu->num_steal);
+    }
+    if (cpu->level_quantam != NULL){
+        fprintf(stdout, "Levels %lld, priority boosts %lld\n", 
+                cpu->num_level, cpu->num_boost);
+    }
+
+    /**
+     * For each core, print its speed, the percentage of time it executes 
+     * processes and its energy. A core executing for a unit of time takes 
+     * the cube of its speed (relative to the base speed) of energy, and 
+     * an idle or loading core takes a fixed percentage of a base core
+     */
+    if (cpu->core_lst != NULL){
+        long double total_energy = 0;
+        for (long long int i = 0; i < cpu->num_core; i++){
+            CoreInfo *core = cpu->core_lst[i];
+            long double speed = core->speed * 1.0 / BASE_SPEED;
+            long double energy = core->exe_time * speed * speed * speed 
+                                + (cpu->curr_time - core->exe_time) 
+                                    * IDLE_POWER_PERCENT / 100.0;
+            total_energy += energy;
+
+            long long int utilisation = 0;
+            if (cpu->curr_time > 0){
+                utilisation = my_ceil(100.0 * core->exe_time 
+                                        / cpu->curr_time);
+            }
+            fprintf(stdout, "Core %lld, speed %lld%%, utilisation %lld%%, "
+                            "energy %lld\n", core->core_id, core->speed, 
+                            utilisation, my_ceil(energy));
+        }
+        fprintf(stdout, "Energy %lld\n", my_ceil(total_energy));
+    }
+
     free(bin);
     bin = NULL;
 }
 
 
+/**
+ * @brief   Run the trace again quietly with Belady optimal page replacement,
+ *          which evicts pages from the process running furthest in the 
+ *          future in the order recorded by the first run. Print the number 
+ *          of pages loaded of both runs, and the makespan of the oracle and 
+ *          its gap to the first run. CLOCK, ARC, LIRS and working-set page 
+ *          replacement follow the rule of virtual memory, so their oracle 
+ *          is virtual memory with the optimal eviction order
+ * 
+ * @param  argu     a ArguInfo data
+ * @param  cpu      the CPUInfo data of the first run
+ */
+void print_oracle(ArguInfo *argu, CPUInfo *cpu){
+
+    char mem_alloc_f = argu->mem_alloc;
+    if (mem_alloc_f == CL_M_FLAG || mem_alloc_f == AR_M_FLAG 
+        || mem_alloc_f == LI_M_FLAG || mem_alloc_f == WS_M_FLAG){
+        mem_alloc_f = VM_M_FLAG;
+    }
+
+    Queue *queue = new_queue(PRIO_ARRIVAL_T);
+    ProcessArena *arena = read_file(queue, argu->filename);
+    CPUInfo *oracle_cpu = init_CPUInfo(argu, mem_alloc_f, arena);
+    oracle_cpu->is_quiet = 1;
+    oracle_cpu->oracle = cpu->oracle;
+    replay_Oracle(cpu->oracle, arena);
+
+    Queue *complete = simulation(argu->sched_algo, mem_alloc_f, 
+                                    queue, oracle_cpu);
+
+    fprintf(stdout, "Page loads %lld, oracle %lld\n", 
+            cpu->memory->num_page_load, oracle_cpu->memory->num_page_load);
+    fprintf(stdout, "Makespan oracle %lld, gap %lld\n", 
+            oracle_cpu->curr_time, cpu->curr_time - oracle_cpu->curr_time);
+
+    oracle_cpu->oracle = NULL;
+    free_queue(queue);
+    free_queue(complete);
+    free_CPUInfo(oracle_cpu);
+    free_ProcessArena(arena);
+}
+
+
 /**
  * @brief Print the usage information for the command line tool
  * 
@@ -222,14 +614,57 @@ void print_usage(char *prog_name)
     fprintf(stderr, "-a <scheduling algorithm> ");
     fprintf(stderr, "-m <memory allocation> ");
     fprintf(stderr, "-s <memory size> ");
-    fprintf(stderr, "[-q <quatum>]");
+    fprintf(stderr, "[-q <quatum>] ");
+    fprintf(stderr, "[-l <placement>] ");
+    fprintf(stderr, "[-O] ");
+    fprintf(stderr, "[-w <window>] ");
+    fprintf(stderr, "[-t <threshold>] ");
+    fprintf(stderr, "[-D] ");
+    fprintf(stderr, "[-P <pages>] ");
+    fprintf(stderr, "[-n <processes>] ");
+    fprintf(stderr, "[-p <page size>] ");
+    fprintf(stderr, "[-H <huge page size>] ");
+    fprintf(stderr, "[-z <pool size>] [-r <ratio>] ");
+    fprintf(stderr, "[-S <seek time>] [-b <bandwidth>] ");
+    fprintf(stderr, "[-W <percent>] ");
+    fprintf(stderr, "[-c <cores>] [-C <speeds>] [-g <core placement>] ");
+    fprintf(stderr, "[-L <quanta>] [-B <boost period>] [-T <latency>]");
     fprintf(stderr, "\n");
     fprintf(stderr, "Notice:\n");
     fprintf(stderr, "\tOption arguments can be passed in any order\n");
-    fprintf(stderr, "\t<scheduling algorithm>\tOne of {ff, rr, cs}\n");
-    fprintf(stderr, "\t<memory allocation>\tOne of {u, p, vm ,cs}\n");
+    fprintf(stderr, "\t<scheduling algorithm>\tOne of {ff, rr, cs, srtf, mlfq, cfs}\n");
+    fprintf(stderr, "\t<memory allocation>\tOne of {u, p, vm ,cs, b, clock, arc, lirs, ws}\n");
     fprintf(stderr, "\t-s <memory size>\tIf '-m u', this can be optional\n");
     fprintf(stderr, "\t[-q <quatum>]   \tOptional\n");
+    fprintf(stderr, "\t[-l <placement>]\tOptional, one of {ff, bf, nf}\n");
+    fprintf(stderr, "\t[-O]            \tOptional, compare with the oracle\n");
+    fprintf(stderr, "\t[-w <window>]   \tOptional, working-set window for '-m ws'\n");
+    fprintf(stderr, "\t[-t <threshold>]\tOptional, page faults within the window\n");
+    fprintf(stderr, "\t                \tas a percentage of memory pages for '-m ws'\n");
+    fprintf(stderr, "\t[-D]            \tOptional, load pages while other processes run\n");
+    fprintf(stderr, "\t[-P <pages>]    \tOptional, pages to prefetch per process for '-m v'\n");
+    fprintf(stderr, "\t[-n <processes>]\tOptional, next processes to prefetch for, default 1\n");
+    fprintf(stderr, "\t[-p <page size>]\tOptional, page size in KB (a power of two), default 4\n");
+    fprintf(stderr, "\t[-H <huge page size>]\tOptional, huge page size in KB for processes at least\n");
+    fprintf(stderr, "\t                \tthat large (a power-of-two number of pages)\n");
+    fprintf(stderr, "\t[-z <pool size>]\tOptional, compressed pool size in KB, a part of the memory\n");
+    fprintf(stderr, "\t[-r <ratio>]    \tOptional, compression ratio of the pool, default 3\n");
+    fprintf(stderr, "\t[-S <seek time>]\tOptional, load pages from a swap device with a seek time\n");
+    fprintf(stderr, "\t[-b <bandwidth>]\tOptional, KB the swap device transfers per second, default 8\n");
+    fprintf(stderr, "\t[-W <percent>]  \tOptional, shared pages a process writes each time it runs\n");
+    fprintf(stderr, "\t                \tfor share groups (5th column of the file), default 10\n");
+    fprintf(stderr, "\t[-c <cores>]    \tOptional, number of cores sharing the memory, default 1\n");
+    fprintf(stderr, "\t                \t(not with -D or '-a srtf')\n");
+    fprintf(stderr, "\t[-C <speeds>]   \tOptional, comma-separated speed of each core, a percentage\n");
+    fprintf(stderr, "\t                \tof the base speed, default 100 (not with '-a srtf')\n");
+    fprintf(stderr, "\t[-g <core placement>]\tOptional, one of {idle, speed}, default idle\n");
+    fprintf(stderr, "\t[-L <quanta>]   \tOptional, comma-separated quantum of each level for\n");
+    fprintf(stderr, "\t                \t'-a mlfq' (at most 8), default quantum doubling for 3 levels\n");
+    fprintf(stderr, "\t[-B <boost period>]\tOptional, time between priority boosts for '-a mlfq',\n");
+    fprintf(stderr, "\t                \tdefault 10 times the quantum of the bottom level\n");
+    fprintf(stderr, "\t[-T <latency>]   \tOptional, target latency for '-a cfs', default 8 times\n");
+    fprintf(stderr, "\t                \tthe quantum, which is the minimum time slice. Nice value\n");
+    fprintf(stderr, "\t                \tof a process is the 6th column of the file, default 0\n");
 }
 
 
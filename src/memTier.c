@@ -0,0 +1,250 @@
+/**
+ * @file      memTier.c
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Implementation of Memory tier module, a compressed pool in
+ *            memory between the memory pages and the disk. Pages evicted
+ *            from memory are compressed into the pool, and the least
+ *            recently evicted pages are written to the disk when the pool
+ *            is full. It includes
+ *              1. creating and destroying a memory tier
+ *              2. moving pages of a process into and out of the pool
+ *              3. counting pages loaded from the pool and the disk, and
+ *                 written to the disk for statistics
+ *
+ *            The processes with pages in the pool are kept in a replacement
+ *            list ordered by when their pages are evicted, each counted as
+ *            its number of pages in the pool, so every operation except
+ *            writing pages to the disk takes O(1) time
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#include "memTier.h"
+#include "replList.h"
+#include "utilities.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+// ============================================================================
+// == | Constant Definitions
+// ============================================================================
+#define TIER_SLOT               2
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+/**
+ * @brief  A memory tier records the number of uncompressed pages the pool
+ *         holds, the list of processes with pages in the pool, and the
+ *         number of pages loaded from the pool and the disk, and written
+ *         from the pool to the disk
+ */
+struct mem_tier {
+    long long int capacity;
+    ReplList pool;
+
+    long long int num_pool_load;
+    long long int num_disk_load;
+    long long int num_disk_write;
+};
+
+
+// ============================================================================
+// == | Function Prototypes
+// ============================================================================
+// Write the least recently evicted pages to the disk until the pool fits
+void write_back(MemTier *tier);
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+/**
+ * @brief  Create a new MemTier with a pool holding a number of
+ *         uncompressed pages
+ *
+ * @param  capacity     the number of uncompressed pages the pool holds
+ * @return MemTier*     return a pointer to the new MemTier
+ */
+MemTier *new_MemTier(long long int capacity){
+
+    assert(capacity > 0);
+
+    MemTier *tier = (MemTier *)malloc(sizeof *tier);
+    if (tier == NULL) {
+        fprintf(stderr, "Error: new_MemTier() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Initalise value of the MemTier
+    tier->capacity = capacity;
+    init_ReplList(&tier->pool, TIER_SLOT);
+    tier->num_pool_load = INITIAL;
+    tier->num_disk_load = INITIAL;
+    tier->num_disk_write = INITIAL;
+
+    return tier;
+}
+
+
+/**
+ * @brief  Destroy and free the memory associated with a MemTier, the
+ *         processes still in the pool are removed from it
+ *
+ * @param  tier     a MemTier
+ */
+void free_MemTier(MemTier *tier){
+
+    // Error if the MemTier does not initalise
+    assert(tier != NULL);
+
+    while (get_repl_lru(&tier->pool) != NULL){
+        remove_repl(get_repl_lru(&tier->pool), TIER_SLOT);
+    }
+
+    // Free the MemTier itself
+    free(tier);
+    tier = NULL;
+}
+
+
+/**
+ * @brief  Return the number of pages of a process in the pool
+ *
+ * @param  tier             a MemTier
+ * @param  p                a ProcessInfo data
+ * @return long long int    number of pages in the pool
+ */
+long long int get_pool_page(MemTier *tier, ProcessInfo *p){
+    if (get_repl_list(p, TIER_SLOT) != &tier->pool){
+        return 0;
+    }
+    return p->repl_node[TIER_SLOT].num_page;
+}
+
+
+/**
+ * @brief  Move a number of evicted pages of a process into the pool, the
+ *         process becomes the most recently evicted. If the pool is full,
+ *         the least recently evicted pages are written to the disk
+ *
+ * @param  tier         a MemTier
+ * @param  p            a ProcessInfo data
+ * @param  num_page     number of pages evicted
+ */
+void demote_page(MemTier *tier, ProcessInfo *p, long long int num_page){
+
+    if (num_page <= 0){
+        return;
+    }
+
+    long long int num_pool = get_pool_page(tier, p) + num_page;
+    remove_repl(p, TIER_SLOT);
+    push_repl(&tier->pool, p, num_pool);
+    write_back(tier);
+}
+
+
+/**
+ * @brief  Load a number of pages of a process, a number of them are taken
+ *         from the pool and the others are read from the disk
+ *
+ * @param  tier         a MemTier
+ * @param  p            a ProcessInfo data
+ * @param  num_page     number of pages loaded
+ * @param  num_pool     number of them taken from the pool, at most the
+ *                      number of pages of the process in the pool
+ */
+void promote_page(MemTier *tier, ProcessInfo *p, long long int num_page,
+                    long long int num_pool){
+
+    long long int num_left = get_pool_page(tier, p) - num_pool;
+    assert(num_pool >= 0 && num_pool <= num_page && num_left >= 0);
+
+    if (num_left == 0){
+        remove_repl(p, TIER_SLOT);
+    } else {
+        set_repl_page(p, TIER_SLOT, num_left);
+    }
+    tier->num_pool_load += num_pool;
+    tier->num_disk_load += num_page - num_pool;
+}
+
+
+/**
+ * @brief  Remove all pages of a finished process from the pool
+ *
+ * @param  tier     a MemTier
+ * @param  p        a ProcessInfo data
+ */
+void drop_page(MemTier *tier, ProcessInfo *p){
+    if (get_repl_list(p, TIER_SLOT) == &tier->pool){
+        remove_repl(p, TIER_SLOT);
+    }
+}
+
+
+/**
+ * @brief  Return the number of pages loaded from the pool
+ *
+ * @param  tier             a MemTier
+ * @return long long int    number of pages
+ */
+long long int get_pool_load(MemTier *tier){
+    return tier->num_pool_load;
+}
+
+
+/**
+ * @brief  Return the number of pages loaded from the disk
+ *
+ * @param  tier             a MemTier
+ * @return long long int    number of pages
+ */
+long long int get_disk_load(MemTier *tier){
+    return tier->num_disk_load;
+}
+
+
+/**
+ * @brief  Return the number of pages written from the pool to the disk
+ *
+ * @param  tier             a MemTier
+ * @return long long int    number of pages
+ */
+long long int get_disk_write(MemTier *tier){
+    return tier->num_disk_write;
+}
+
+
+// ============================================================================
+// == | Auxillary Functions
+// ============================================================================
+/**
+ * @brief  Write the pages of the least recently evicted processes to the
+ *         disk until the pool holds at most its capacity, the last process
+ *         may keep some of its pages in the pool
+ *
+ * @param  tier     a MemTier
+ */
+void write_back(MemTier *tier){
+
+    while (tier->pool.num_page > tier->capacity){
+        ProcessInfo *lru = get_repl_lru(&tier->pool);
+        long long int num_over = tier->pool.num_page - tier->capacity;
+        long long int num_pool = lru->repl_node[TIER_SLOT].num_page;
+
+        if (num_pool <= num_over){
+            remove_repl(lru, TIER_SLOT);
+            tier->num_disk_write += num_pool;
+        } else {
+            set_repl_page(lru, TIER_SLOT, num_pool - num_over);
+            tier->num_disk_write += num_over;
+        }
+    }
+}
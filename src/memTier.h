@@ -0,0 +1,61 @@
+/**
+ * @file      memTier.h
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Memory tier module, a compressed pool in memory between the
+ *            memory pages and the disk. Pages evicted from memory are
+ *            compressed into the pool, and the least recently evicted
+ *            pages are written to the disk when the pool is full.
+ *            It includes
+ *              1. creating and destroying a memory tier
+ *              2. moving pages of a process into and out of the pool
+ *              3. counting pages loaded from the pool and the disk, and
+ *                 written to the disk for statistics
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#ifndef MEMTIER_H
+#define MEMTIER_H
+
+#include "processInfo.h"
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+typedef struct mem_tier MemTier;
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+// Create a new MemTier with a pool holding a number of uncompressed pages
+MemTier *new_MemTier(long long int capacity);
+
+// Destroy and free the memory associated with a MemTier
+void free_MemTier(MemTier *tier);
+
+// Return the number of pages of a process in the pool
+long long int get_pool_page(MemTier *tier, ProcessInfo *p);
+
+// Move a number of evicted pages of a process into the pool
+void demote_page(MemTier *tier, ProcessInfo *p, long long int num_page);
+
+// Load a number of pages of a process, some of them from the pool
+void promote_page(MemTier *tier, ProcessInfo *p, long long int num_page,
+                    long long int num_pool);
+
+// Remove all pages of a finished process from the pool
+void drop_page(MemTier *tier, ProcessInfo *p);
+
+// Return the number of pages loaded from the pool
+long long int get_pool_load(MemTier *tier);
+
+// Return the number of pages loaded from the disk
+long long int get_disk_load(MemTier *tier);
+
+// Return the number of pages written from the pool to the disk
+long long int get_disk_write(MemTier *tier);
+
+#endif
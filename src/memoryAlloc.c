@@ -5,6 +5,20 @@
  *              1. Simulate memory allocation
  *              2. print Execution transcript. including running, evict, finish
  *              3. evict pages
+ *              4. keep an eviction index of processes with pages in memory
+ *              5. Simulate buddy allocation
+ *              6. evict pages by CLOCK (second-chance) page replacement
+ *              7. evict pages by ARC and LIRS page replacement
+ *              8. working-set page replacement and thrashing control
+ *              9. keep the pages being loaded by the I/O device in memory
+ *              10. prefetch pages of the next waiting processes
+ *              11. allocate huge pages, aligned runs of pages, to large 
+ *                  processes
+ *              12. load pages from the compressed pool or the disk
+ *              13. read and write pages in extents on the swap device
+ *              14. share the pages of a share group copy-on-write
+ *              15. keep the pages of the processes running on other cores 
+ *                  in memory
  *
  * @copyright created for COMP30023 Computer System 2020
  *
@@ -22,28 +36,101 @@
 // ============================================================================
 // == | Constant Definitions 
 // ============================================================================
-#define PAGE_SIZE               4
 #define MIN_EXE_PAGE            4
-#define LOAD_TIME               2
+#define LOAD_SETUP_TIME         1
+#define KB_PER_LOAD_TIME        4
+#define KB_PER_POOL_LOAD_TIME   16
 
 
 // ============================================================================
 // == | Function Prototypes
 // ============================================================================
+// Get the eviction index of the memory, create it if it does not exist
+Queue *get_evict_index(char mem_alloc_f, CPUInfo *cpu);
+
+// Simulate buddy allocation before a process can be executed on the CPU
+void buddy_alloc_func(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p);
+
 // Evict number of pages from the processes until reach the requirement
-void evcit(char mem_alloc_f, Queue *queue, CPUInfo *cpu,  
+void evcit(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p, 
             long long int curr_require_page);
+
+// Evict pages by CLOCK page replacement until reach the requirement
+long long int clock_evict(CPUInfo *cpu, ProcessInfo *p, 
+                            long long int curr_require_page);
+
+// Free a page in the memory without removing it from the page list
+void free_frame(MemoryInfo *memory, long long int ind);
+
+// Set the reference bits of all pages of a process
+void reference_pages(MemoryInfo *memory, ProcessInfo *p);
+
+// Return if pages need to be evicted to allocate a number of pages
+int need_evict(MemoryInfo *memory, ProcessInfo *p, 
+                long long int curr_require_page);
+
+// Return the number of pages a process requires, based on its page size
+long long int get_require_page(MemoryInfo *memory, ProcessInfo *p);
+
+// Return the time to load a number of pages of a page size
+long long int get_load_time(MemoryInfo *memory, long long int page_ratio, 
+                            long long int num_page);
+
+// Return the time to load a number of pages of a process from the tiers
+long long int get_tier_load_time(MemoryInfo *memory, ProcessInfo *p, 
+                                    long long int num_page);
+
+// Return the time to load a number of pages of a process from the disk
+long long int get_disk_load_time(MemoryInfo *memory, ProcessInfo *p, 
+                                    long long int num_page);
+
+// Map the shared segment of a process and return the time to load it
+long long int map_shared(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p);
+
+// Unmap the shared segment of a process which stops running
+void unmap_shared(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p, 
+                    int is_leave);
+
+// Return the number of empty pages can be allocated in pages of a page size
+long long int get_free_page(MemoryInfo *memory, long long int page_ratio);
+
+// Return the first empty huge page from a page
+long long int find_huge_page(MemoryInfo *memory, long long int page_ratio, 
+                                long long int from);
+
+// Allocate a number of pages in the lowest empty huge pages to a process
+void claim_huge_pages(MemoryInfo *memory, ProcessInfo *p, 
+                        long long int num_page);
+
+// Record a number of pages of a process are evicted for statistics
+void record_evict(MemoryInfo *memory, ProcessInfo *p, long long int num_page);
+
+// Evict the pages of processes not run within the working-set window
+void trim_working_set(char mem_alloc_f, CPUInfo *cpu);
+
+// Return if a process had page faults within the working-set window
+int is_high_fault_rate(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p);
+
 // Compare two long long integer values, a and b
 int long_int_comparator(const void * a, const void *b);
 
+// Allocate a number of empty pages with the lowest addresses to a process
+void claim_pages(MemoryInfo *memory, ProcessInfo *p, long long int num_page);
+
+// Find a hole for a number of pages based on the contiguous placement method
+long long int find_placement(MemoryInfo *memory, long long int num_page);
+
+// Allocate a range of empty pages to a process
+void claim_range(MemoryInfo *memory, ProcessInfo *p, 
+                    long long int start, long long int num_page);
+
+// Record the hole count and the largest hole for fragmentation statistics
+void record_fragmentation(MemoryInfo *memory);
+
 // Free the pages in the memory that previously occupied by a process
 long long int free_page(CPUInfo *cpu, ProcessInfo *p, long long int *page_list, 
                    long long int num_page,long long int start);
 
-// Remove N element for a long long int list
-long long int *remove_n_element(long long int *page_list, 
-                                long long int n, long long int p_size);
-
 // Print the currently execution message for the memory size is unlimited
 void print_running(CPUInfo *cpu, ProcessInfo *p);
 
@@ -53,6 +140,16 @@ void print_mem_running(CPUInfo *cpu, ProcessInfo *p);
 // Print the evicted message
 void print_evicted(CPUInfo *cpu, long long int *page_list, long long int p_size);
 
+// Print the pages evicted but not printed yet in one evicted message
+void print_evict_list(CPUInfo *cpu);
+
+// Print the suspended message
+void print_suspended(CPUInfo *cpu, ProcessInfo *p);
+
+// Print the prefetched message
+void print_prefetched(CPUInfo *cpu, ProcessInfo *p, 
+                        long long int *page_list, long long int p_size);
+
 
 // ============================================================================
 // == | Main Functions
@@ -61,12 +158,10 @@ void print_evicted(CPUInfo *cpu, long long int *page_list, long long int p_size)
  * @brief  Simulate memory allocation before a process can be executed on the CPU
  * 
  * @param  mem_alloc_f  a memory allocation method flag
- * @param  queue        a Queue of processes
  * @param  cpu          a CPUInfo data
  * @param  p            a ProcessInfo data
  */
-void mem_alloc_func(char mem_alloc_f, Queue *queue, 
-                    CPUInfo *cpu, ProcessInfo *p){
+void mem_alloc_func(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p){
     
     /**
      * If the memory is unlimited, then memory management and 
@@ -80,14 +175,64 @@ void mem_alloc_func(char mem_alloc_f, Queue *queue,
         return;
     }
 
-    // Calculate how many page need to be allocated in total and for this time
-    long long int total_require_page = p->mem_size_req / PAGE_SIZE;
+    // Calculate how many page need to be allocated in total
+    long long int total_require_page = get_require_page(cpu->memory, p);
+
+    /**
+     * A running process can not be evicted. ARC and LIRS page replacement
+     * keep their own lists of processes. CLOCK page replacement evicts
+     * pages instead of processes, so it does not need the eviction index
+     */
+    if(cpu->memory->adapt != NULL){
+        access_repl(cpu->memory->adapt, p, 0);
+    } else if(mem_alloc_f != CL_M_FLAG){
+        remove_queue_point(get_evict_index(mem_alloc_f, cpu), p);
+    }
+
+    // The pages prefetched are used, they are not loaded again
+    p->num_prefetch = 0;
+
+    // The process runs, so its pages in memory become dirty
+    p->num_clean_page = 0;
+
+    /**
+     * For Working Set, the pages of processes not run within the window
+     * are evicted first
+     */
+    if(mem_alloc_f == WS_M_FLAG){
+        trim_working_set(mem_alloc_f, cpu);
+    }
+
+    // Buddy allocation allocates a power-of-two block of pages
+    if(mem_alloc_f == BU_M_FLAG){
+        buddy_alloc_func(mem_alloc_f, cpu, p);
+        return;
+    }
+
+    // The shared pages of the process are loaded first
+    long long int share_load_time = 0;
+    if (p->share != NULL){
+        share_load_time = map_shared(mem_alloc_f, cpu, p);
+    }
+
+    // Calculate how many page need to be allocated for this time
     long long int curr_require_page = total_require_page - p->num_page_in_mem;
 
+    /**
+     * The empty pages can be allocated, and the minimum pages to execute, 
+     * in whole pages of the page size of the process
+     */
+    long long int page_ratio = p->page_ratio;
+    long long int num_free = get_free_page(cpu->memory, page_ratio);
+    long long int min_exe_page = 
+                (MIN_EXE_PAGE + page_ratio - 1) / page_ratio * page_ratio;
+
     //If all pages a process requires are in memory already, it can be executed
     if(curr_require_page == 0){
-        p->load_time = 0;
+        p->load_time = share_load_time;
         p->page_fault = 0;
+        reference_pages(cpu->memory, p);
+        print_evict_list(cpu);
         print_mem_running(cpu, p);
         return;
     } 
@@ -98,16 +243,32 @@ void mem_alloc_func(char mem_alloc_f, Queue *queue,
      * some or all pages need to be evicted to make space for this process 
      * until they reach the execution requiremnt 
      */
-     if (curr_require_page > cpu->memory->num_holes){
+     if (curr_require_page > num_free){
         if(mem_alloc_f == SP_M_FLAG){
             /**
              * For Swapping, all pages need to be evicated
              */
-            evcit(mem_alloc_f, queue, cpu, curr_require_page);
-        } else if (mem_alloc_f == VM_M_FLAG || mem_alloc_f == CM_M_FLAG){
+            evcit(mem_alloc_f, cpu, p, curr_require_page);
+        } else if (is_high_fault_rate(mem_alloc_f, cpu, p)){
+            /**
+             * For Working Set, a process which had page faults within the 
+             * window is given all pages it requires (at most the memory)
+             */
+            long long int max_page = cpu->memory->total_page 
+                                        / page_ratio * page_ratio
+                                        - cpu->memory->num_page_io 
+                                        - p->num_page_in_mem;
+            if (curr_require_page > max_page){
+                curr_require_page = max_page;
+            }
+            evcit(mem_alloc_f, cpu, p, curr_require_page);
+        } else if (mem_alloc_f == VM_M_FLAG || mem_alloc_f == CM_M_FLAG
+                    || mem_alloc_f == CL_M_FLAG || mem_alloc_f == AR_M_FLAG
+                    || mem_alloc_f == LI_M_FLAG || mem_alloc_f == WS_M_FLAG){
             /**
-             * For Virtual Memory and Customised Memory Management (which 
-             * followed the same rule of virtual memory), 
+             * For Virtual Memory, Customised Memory Management, CLOCK, 
+             * ARC, LIRS and Working Set (which followed the same rule of 
+             * virtual memory), 
              * a process can be executed if it is allocated at 
              * least 16KB of its memory requirement (i.e., 4 pages) 
              * or all memory it requires if its requirement is less than 16KB
@@ -115,23 +276,23 @@ void mem_alloc_func(char mem_alloc_f, Queue *queue,
              * given either all of the empty pages or enough to meet its 
              * memory requirements
              */
-            if (p->num_page_in_mem < MIN_EXE_PAGE){
+            if (p->num_page_in_mem < min_exe_page){
                 
-                if(cpu->memory->num_holes < MIN_EXE_PAGE){
+                if(num_free < min_exe_page){
         
                     // Find the minimum allocation required to execute a page
-                    if (p->num_page_in_mem + curr_require_page > MIN_EXE_PAGE){
-                        curr_require_page = MIN_EXE_PAGE - p->num_page_in_mem;
+                    if (p->num_page_in_mem + curr_require_page > min_exe_page){
+                        curr_require_page = min_exe_page - p->num_page_in_mem;
                     } 
 
-                     if (curr_require_page > cpu->memory->num_holes){
+                     if (curr_require_page > num_free){
                          /**
                          * Evicting page only occur if a process memory 
                          * requirement is larger or equal to 4 pages, and the  
                          * sum of its memory allocation in memory currently 
                          * and empty pages now available is less than 4 pages
                          */
-                        evcit(mem_alloc_f, queue, cpu, curr_require_page);
+                        evcit(mem_alloc_f, cpu, p, curr_require_page);
                     } else {
                         /**
                          * If the sum of its memory allocation in memory 
@@ -139,7 +300,7 @@ void mem_alloc_func(char mem_alloc_f, Queue *queue,
                          * or larger than 4 pages, give all of the empty pages 
                          * to the process.
                          */
-                        curr_require_page = cpu->memory->num_holes;
+                        curr_require_page = num_free;
                     }
 
                     
@@ -147,14 +308,14 @@ void mem_alloc_func(char mem_alloc_f, Queue *queue,
                     /**
                      * If there are enough empty pages available (i.e. more than 4 pages
                      */
-                    curr_require_page = cpu->memory->num_holes;
+                    curr_require_page = num_free;
                 }
             } else {
                 /**
                  * If the process has enough pages in memory or there are 
                  * enough empty pages available (i.e. more than 4 pages
                  */
-                curr_require_page = cpu->memory->num_holes;
+                curr_require_page = num_free;
             }
             
         }
@@ -163,51 +324,34 @@ void mem_alloc_func(char mem_alloc_f, Queue *queue,
 
 
     
-    // Allocate the memory to the process
-    long long int p_page_ind = 0;
-    for(long long int i = 0; i < cpu->memory->total_page; i++){
-        if (p_page_ind == curr_require_page){
-            break;
-        }
-
-        if(cpu->memory->is_occupy_lst[i] == INVALID){
-            cpu->memory->is_occupy_lst[i] = p->p_id;
-            cpu->memory->num_holes -= 1;
-            p_page_ind ++;
-        } 
-    }
-
-    // Get the memory address (i.e. sets of pages) for the process
-    long long int *p_page_lst = (long long int *)malloc(total_require_page 
-                                            * (sizeof(long long int)));
-    assert(p_page_lst != NULL);
-    long long int occupy = curr_require_page + p->num_page_in_mem;
-    p_page_ind = 0;
-    for(long long int i = 0; i < cpu->memory->total_page; i++){
-        if (p_page_ind == occupy){
-            break;
-        }
-
-        if (cpu->memory->is_occupy_lst[i] == p->p_id){
-            p_page_lst[p_page_ind] = i;
-            p_page_ind ++;
-        }
-    }
-
-
-    // Update the pages list which used by the process
-    free(p->page_list);
-    p->page_list = NULL;
-    p->page_list = p_page_lst;
+    /**
+     * Allocate the memory to the process, and add the new memory address
+     * (i.e. sets of pages) to the page list of the process
+     */
+    claim_pages(cpu->memory, p, curr_require_page);
+    merge_pages(&p->page_list, cpu->memory->claim_list, curr_require_page);
+    record_fragmentation(cpu->memory);
 
     // Update the required loading time 
-    p->load_time = curr_require_page * LOAD_TIME;
+    p->load_time = share_load_time 
+                    + get_tier_load_time(cpu->memory, p, curr_require_page);
+    if (cpu->memory->swap != NULL){
+        p->load_time += flush_swap(cpu->memory->swap);
+    }
+    cpu->memory->num_page_load += curr_require_page;
     p->num_page_in_mem += curr_require_page;
     
     // Update the page fault
     p->page_fault = total_require_page - p->num_page_in_mem;
     p->remaining_time += p->page_fault;
 
+    // For Working Set, record the pages loaded and missing as page faults
+    if (mem_alloc_f == WS_M_FLAG){
+        record_fault(cpu->memory->load_ctrl, cpu->curr_time, 
+                        curr_require_page + p->page_fault);
+        p->last_fault_time = cpu->curr_time;
+    }
+
     // Calcatue the current memory usage
     long long int new_usage = my_ceil(100 * 
                     (curr_require_page * 1.0 / cpu->memory->total_page * 1.0));
@@ -215,266 +359,1417 @@ void mem_alloc_func(char mem_alloc_f, Queue *queue,
     cpu->memory->memory_use += new_usage ;
 
     // Print the process currently execution transcript
+    reference_pages(cpu->memory, p);
+    print_evict_list(cpu);
     print_mem_running(cpu, p);
 }
 
 /**
- * @brief  Print the process finish message 
+ * @brief  Record a process which stops running before it finishes as 
+ *         a candidate for eviction, if it has pages in memory
  * 
  * @param  mem_alloc_f  a memory allocation method flag
  * @param  cpu          a CPUInfo data
  * @param  p            a ProcessInfo data
- * @param  queue        a Queue of processes
  */
-void print_finished(char mem_alloc_f, CPUInfo *cpu, 
-                    ProcessInfo *p, Queue *queue){
+void mem_suspend_func(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p){
 
-    if(mem_alloc_f != UN_M_FLAG){
-        print_evicted(cpu, p->page_list, p->num_page_in_mem);
-        free_page(cpu, p, NULL, p->num_page_in_mem, -1);
+    /**
+     * The process wrote to some of its shared pages while it ran, they 
+     * are copied and become its own pages. The parts of pages written are
+     * carried to the next time it runs. A process with all its shared 
+     * pages copied leaves its share group, it does not map the segment 
+     * again. The pages of a segment freed are printed with the next 
+     * pages evicted
+     */
+    if (cpu->memory->is_share && p->share != NULL){
+        p->cow_write += p->num_share_page * cpu->memory->cow_percent;
+        long long int num_break = p->cow_write / 100;
+        p->cow_write %= 100;
+        p->num_share_page -= num_break;
+        p->total_require_page += num_break;
+        cpu->memory->num_cow_break += num_break;
+
+        int is_leave = p->num_share_page == 0;
+        unmap_shared(mem_alloc_f, cpu, p, is_leave);
+        if (is_leave){
+            p->share = NULL;
+        }
     }
 
-    fprintf(stdout, "%lld, FINISHED, id=%lld, proc-remaining=%lld\n",
-        cpu->curr_time, p->p_id, get_queue_size(queue));
-    
+    if (mem_alloc_f == UN_M_FLAG || mem_alloc_f == CL_M_FLAG 
+        || p->num_page_in_mem == 0){
+        return;
+    }
+
+    if (cpu->memory->adapt != NULL){
+        suspend_repl(cpu->memory->adapt, p);
+    } else {
+        enqueue(get_evict_index(mem_alloc_f, cpu), p);
+    }
 }
 
 
-// ============================================================================
-// == | Auxillary Functions 
-// ============================================================================
 /**
- * @brief  Evict number of pages from the processes until reach the requirement
+ * @brief  Return if a process can run now. For Working Set, if the memory 
+ *         is thrashing, a process without all its pages in memory is 
+ *         suspended, and its pages are all evicted (swapped out)
  * 
  * @param  mem_alloc_f  a memory allocation method flag
- * @param  queue        a Queue of processes
  * @param  cpu          a CPUInfo data
- * @param  curr_require_page    total number of page need to be evicted
+ * @param  p            a ProcessInfo data
+ * @return int          1 if the process can run, 0 if it is suspended
  */
-void evcit(char mem_alloc_f, Queue *queue, CPUInfo *cpu, 
-        long long int curr_require_page){
-    
-    
-    Queue *resort_queue = new_queue();
-
-    // Default page replacement method is least-recently-executed 
-    char *prio_flag = PRIO_LAST_EXE_T;
-    if (mem_alloc_f == CM_M_FLAG){
-        /**
-         * For Customerised Memory Mangement, evicting the pages of a process
-         * which has shortest remaining time 
-         */
-        prio_flag = PRIO_MAX_PAGE;
-    }
+int mem_admit_func(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p){
 
-    /**
-     * Sort the processes based on the page replacement in ascending order
-     * (least-recently-executed or shortest-remaining-time)
-     */
-    for (long long int i = 0; i < get_queue_size(queue); i++){
- 
-        enqueue(resort_queue, get_queue_point(queue, i), prio_flag);
+    if (!is_mem_thrashing(mem_alloc_f, cpu) 
+        || p->num_page_in_mem == get_require_page(cpu->memory, p)){
+        return 1;
     }
 
-    // A list to record evict pages
-    long long int *evict_list = (long long int *)malloc(sizeof(long long int) * 
-                                            cpu->memory->total_page);
-    long long int evict_ind = 0;
-
-    // Evict number of pages from the processes until reach the requirement
-    while(curr_require_page > cpu->memory->num_holes){
-         
-        ProcessInfo *evict_p = dequeue(resort_queue);
-        
-        if(evict_p->page_list != NULL){
-            /**
-             * If a process has memory pages, a certain number of pages need to
-             * be required, based on how many pages it has and how many required
-             */
-
-            // Calculate how many pages need be required for this process
-            long long int num_free = evict_p->num_page_in_mem;
-            if(mem_alloc_f == VM_M_FLAG || mem_alloc_f == CM_M_FLAG){
-                if(num_free >= curr_require_page - cpu->memory->num_holes){
-                    num_free = curr_require_page - cpu->memory->num_holes;
-                }
-            }
-
-            if (num_free > 0){
-                // evict pages
-                evict_ind = free_page(cpu, evict_p, evict_list, 
-                                    num_free, evict_ind);
-            }
-           
-        }
-        
+    // Swap out the process entirely
+    MemoryInfo *memory = cpu->memory;
+    remove_queue_point(get_evict_index(mem_alloc_f, cpu), p);
+    if (p->num_page_in_mem > 0){
+        record_evict(memory, p, p->num_page_in_mem);
+        memory->num_evict_list = free_page(cpu, p, memory->evict_list, 
+                                p->num_page_in_mem, memory->num_evict_list);
     }
+    print_evict_list(cpu);
 
-    // Sort the total evict pages in ascending order
-    qsort(evict_list, evict_ind, sizeof(long long int), long_int_comparator);
-    
-    // Print the evicted message
-    print_evicted(cpu, evict_list, evict_ind);
-
-
-    // Free the memory allocated for unused list and queue
-    free(evict_list);
-    while(get_queue_size(resort_queue) > 0){
-        dequeue(resort_queue);
-    }
-    free_queue(resort_queue);
-    resort_queue = NULL;
+    record_suspend(memory->load_ctrl);
+    print_suspended(cpu, p);
+    return 0;
 }
 
 
 /**
- * @brief  Compare two long long integer values, a and b
+ * @brief  Return if the memory is thrashing, i.e. for Working Set, the page
+ *         faults within the window are more than the threshold
  * 
- * @param  a        a long long int value
- * @param  b        a long long int value
- * @return int      0 if they are equal
- *                  1 if a > b
- *                  -1 if a < b
+ * @param  mem_alloc_f  a memory allocation method flag
+ * @param  cpu          a CPUInfo data
+ * @return int          1 if thrashing, 0 otherwise
  */
-int long_int_comparator(const void * a, const void *b)
-{
-    const long long int ia = *(const long long int *)a;
-    const long long int ib = *(const long long int *)b;
-
-	if (ia == ib)
-		return 0;
-	if (ia > ib)
-		return 1;
-	return -1;
+int is_mem_thrashing(char mem_alloc_f, CPUInfo *cpu){
+    return mem_alloc_f == WS_M_FLAG 
+            && is_thrashing(cpu->memory->load_ctrl, cpu->curr_time);
 }
 
+
 /**
- * @brief  Free the pages in the memory that previously occupied by a process
+ * @brief  Prefetch pages of the next waiting processes in the order they 
+ *         run while a process executes, the device loading pages is idle
+ *         meanwhile. For Virtual Memory only, at most the number of pages 
+ *         for each process and the number of processes set are prefetched,
+ *         and only into empty pages. A process with pages prefetched is a 
+ *         candidate for eviction until it runs
  * 
+ * @param  mem_alloc_f      a memory allocation method flag
  * @param  cpu              a CPUInfo data
- * @param  p                a ProcessInfo data
- * @param  page_list        a page list record which pages be freed
- * @param  num_free         number of pages that needed free
- * @param  start            index of the page list before new free be made
- * @return long long int    index of the free page list after new free be made
+ * @param  waiting_queue    a queue of processes waiting to be executed
+ * @param  exe_time         the time the process executes
  */
-long long int free_page(CPUInfo *cpu, ProcessInfo *p, long long int *page_list, 
-                    long long int num_free, long long int start){
-    
-    // Free the pages from the memory and record to free page list if necessary
-    for(long long int i = 0; i < num_free; i++){
-        long long int ind = p->page_list[i];
-        cpu->memory->is_occupy_lst[ind] = INVALID;
+void mem_prefetch_func(char mem_alloc_f, CPUInfo *cpu, 
+                        Queue *waiting_queue, long long int exe_time){
 
-        // Record the free pages
-        if (page_list != NULL){
-            page_list[start] = ind;
-            start ++;
-        }
+    MemoryInfo *memory = cpu->memory;
+    if (mem_alloc_f != VM_M_FLAG || memory->prefetch_proc == 0 
+        || cpu->io != NULL){
+        return;
     }
 
-    // Update the number of holes in memory
-    cpu->memory->num_holes += num_free;
-
-    // Update the page list for a process occupied in memory and number of it
-    if (num_free == p->num_page_in_mem){
-        free(p->page_list);
-        p->page_list = NULL;
-    } else {
-        p->page_list = remove_n_element(p->page_list, num_free, 
-                                        p->num_page_in_mem);
+    ProcessInfo **next_lst = (ProcessInfo **)malloc(
+                                memory->prefetch_proc * sizeof(ProcessInfo *));
+    if (next_lst == NULL) {
+        fprintf(stderr, "Error: mem_prefetch_func() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
     }
-    p->num_page_in_mem -= num_free;
+    long long int num_next = peek_queue(waiting_queue, next_lst, 
+                                        memory->prefetch_proc);
+
+    // Number of pages can be loaded while the process executes
+    long long int budget = exe_time / get_load_time(memory, 1, 1);
+    for (long long int i = 0; i < num_next && budget > 0; i++){
+
+        // Huge pages are not prefetched
+        ProcessInfo *next_p = next_lst[i];
+        long long int num_page = get_require_page(memory, next_p) 
+                                    - next_p->num_page_in_mem;
+        if (next_p->page_ratio > 1){
+            continue;
+        }
+        if (num_page > memory->prefetch_page){
+            num_page = memory->prefetch_page;
+        }
+        if (num_page > budget){
+            num_page = budget;
+        }
+        if (num_page > memory->num_holes){
+            num_page = memory->num_holes;
+        }
+        if (num_page <= 0){
+            continue;
+        }
 
-    // Update the memory usage of a process after some pages be freed
-    long long int free_usage = my_ceil(100 * 
-                            (num_free * 1.0 / cpu->memory->total_page * 1.0));
-    p->mem_usage -= free_usage;
-    cpu->memory->memory_use -= free_usage;
+        claim_pages(memory, next_p, num_page);
+        merge_pages(&next_p->page_list, memory->claim_list, num_page);
+        record_fragmentation(memory);
+
+        // The pages are loaded from the tiers while the process executes
+        get_tier_load_time(memory, next_p, num_page);
+        next_p->num_clean_page += num_page;
+        next_p->num_page_in_mem += num_page;
+        next_p->num_prefetch += num_page;
+        memory->num_prefetch += num_page;
+        budget -= num_page;
+
+        long long int new_usage = my_ceil(100 * 
+                            (num_page * 1.0 / memory->total_page * 1.0));
+        next_p->mem_usage += new_usage;
+        memory->memory_use += new_usage;
+
+        if (next_p->index_pos == INVALID){
+            enqueue(get_evict_index(mem_alloc_f, cpu), next_p);
+        }
 
+        print_prefetched(cpu, next_p, memory->claim_list, num_page);
+    }
 
-    // Return the current index of free page list 
-    return start;
+    free(next_lst);
+    next_lst = NULL;
 }
 
+
 /**
- * @brief  Remove N element for a long long int list
+ * @brief  Return if a process can be allocated while the pages of other 
+ *         processes are being loaded by the I/O device or running on other 
+ *         cores, they can not be evicted. The pages it requires at least (all its pages for 
+ *         Swapping, at least 4 pages otherwise) must fit in the rest of the 
+ *         memory. For buddy allocation, a block must be empty already
  * 
- * @param  page_list        a long long int list
- * @param  n                number of elements (N) need be removed
- * @param  p_size           total number of elements of the long long int list
- * @return long long int*   the new list after remove N elements
+ * @param  mem_alloc_f  a memory allocation method flag
+ * @param  cpu          a CPUInfo data
+ * @param  p            a ProcessInfo data
+ * @return int          1 if it can be allocated, 0 otherwise
  */
-long long int *remove_n_element(long long int *page_list, 
-                                long long int n, long long int p_size){
+int mem_can_load_func(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p){
 
-    // Remove N element for a long long int list
-    long long int remain = p_size - n;
-    long long int *new_p_list = (long long int *)malloc(remain 
-                                                    * (sizeof(long long int)));
-    for(long long int i = 0; i < remain; i++){
-        new_p_list[i] = page_list[n + i];
+    MemoryInfo *memory = cpu->memory;
+    if (mem_alloc_f == UN_M_FLAG || memory->num_page_io == 0){
+        return 1;
     }
 
-    free(page_list);
-    page_list = NULL;
+    long long int total_require_page = get_require_page(memory, p);
+    if (memory->buddy != NULL){
+        return p->num_page_in_mem > 0 || !need_evict(memory, p, 
+                    get_block_page(memory->buddy, total_require_page));
+    }
+
+    long long int page_ratio = p->page_ratio;
+    long long int min_page = total_require_page;
+    if (mem_alloc_f != SP_M_FLAG && min_page > MIN_EXE_PAGE){
+        min_page = (MIN_EXE_PAGE + page_ratio - 1) / page_ratio * page_ratio;
+    }
 
-    // Return the new list after remove N elements
-    return new_p_list;
+    // The pages being loaded may split the huge pages, so they must be empty
+    if (page_ratio > 1){
+        return min_page - p->num_page_in_mem 
+                <= get_free_page(memory, page_ratio);
+    }
+    return min_page <= memory->total_page - memory->num_page_io;
 }
 
 
 /**
- * @brief  Print a process currently execution message for unlimited memory size
+ * @brief  Record the pages of a process are being loaded by the I/O device,
+ *         or it runs on a core, they can not be evicted until it is 
+ *         executed or stops running
  * 
  * @param  cpu  a CPUInfo data
  * @param  p    a ProcessInfo data
  */
-void print_running(CPUInfo *cpu, ProcessInfo *p){
-    fprintf(stdout, "%lld, RUNNING, id=%lld, remaining-time=%lld\n",
-            cpu->curr_time, p->p_id, p->remaining_time);
+void mem_load_func(CPUInfo *cpu, ProcessInfo *p){
+    cpu->memory->num_page_io += p->num_page_in_mem;
 }
 
+
 /**
- * @brief  Print a process currently execution message for limited memory size 
+ * @brief  Record a process stops running on a core, its pages can be 
+ *         evicted again
  * 
- * @param  cpu  a CPUInfo data 
+ * @param  cpu  a CPUInfo data
  * @param  p    a ProcessInfo data
  */
-void print_mem_running(CPUInfo *cpu, ProcessInfo *p){
-   fprintf(stdout, "%lld, RUNNING, id=%lld, remaining-time=%lld, "
-                    "load-time=%lld, mem-usage=%d%%, mem-addresses=[",
-                    cpu->curr_time, p->p_id, p->remaining_time, 
-                    p->load_time, cpu->memory->memory_use);
+void mem_release_func(CPUInfo *cpu, ProcessInfo *p){
+    cpu->memory->num_page_io -= p->num_page_in_mem;
+    assert(cpu->memory->num_page_io >= 0);
+}
 
-    for (long long int i = 0; i < p->num_page_in_mem; i++){
-        fprintf(stdout, "%lld", p->page_list[i]);
-        if (i != p->num_page_in_mem - 1){
-            fprintf(stdout, ",");
+
+/**
+ * @brief  Record the pages of a process are loaded by the I/O device, 
+ *         and it is executed without loading time. ARC and LIRS page 
+ *         replacement record it is going to run again
+ * 
+ * @param  cpu  a CPUInfo data
+ * @param  p    a ProcessInfo data
+ */
+void mem_loaded_func(CPUInfo *cpu, ProcessInfo *p){
+    cpu->memory->num_page_io -= p->num_page_in_mem;
+    assert(cpu->memory->num_page_io >= 0);
+
+    p->load_time = 0;
+    if(cpu->memory->adapt != NULL){
+        access_repl(cpu->memory->adapt, p, 1);
+    }
+    reference_pages(cpu->memory, p);
+    print_evict_list(cpu);
+    print_mem_running(cpu, p);
+}
+
+
+/**
+ * @brief  Print the process finish message 
+ * 
+ * @param  mem_alloc_f      a memory allocation method flag
+ * @param  cpu              a CPUInfo data
+ * @param  p                a ProcessInfo data
+ * @param  proc_remaining   number of processes waiting to run
+ */
+void print_finished(char mem_alloc_f, CPUInfo *cpu, 
+                    ProcessInfo *p, long long int proc_remaining){
+
+    if(cpu->memory->adapt != NULL){
+        finish_repl(cpu->memory->adapt, p);
+    }
+    if(cpu->memory->tier != NULL){
+        drop_page(cpu->memory->tier, p);
+    }
+    /**
+     * The pages of the process, and of its shared segment if it was the 
+     * last process of its group, are printed in one evicted message
+     */
+    MemoryInfo *memory = cpu->memory;
+    if(mem_alloc_f != UN_M_FLAG){
+        memory->num_evict_list = free_page(cpu, p, memory->evict_list, 
+                                p->num_page_in_mem, memory->num_evict_list);
+    }
+    if(memory->is_share && p->share != NULL){
+        unmap_shared(mem_alloc_f, cpu, p, 1);
+    }
+    print_evict_list(cpu);
+
+    if (cpu->is_quiet){
+        return;
+    }
+    fprintf(stdout, "%lld, FINISHED, id=%lld, proc-remaining=%lld\n",
+        cpu->curr_time, p->p_id, proc_remaining);
+    
+}
+
+
+// ============================================================================
+// == | Auxillary Functions 
+// ============================================================================
+/**
+ * @brief  Get the eviction index of the memory, create it if it does not exist
+ * 
+ * @param  mem_alloc_f      a memory allocation method flag
+ * @param  cpu              a CPUInfo data
+ * @return Queue*           the eviction index
+ */
+Queue *get_evict_index(char mem_alloc_f, CPUInfo *cpu){
+
+    if (cpu->memory->evict_index == NULL){
+        // Default page replacement method is least-recently-executed 
+        QueuePrio prio = PRIO_LAST_EXE_T;
+        if (mem_alloc_f == CM_M_FLAG){
+            /**
+             * For Customerised Memory Mangement, the order is based on 
+             * the number of pages a process has in memory, the fewest first
+             */
+            prio = PRIO_MIN_PAGE;
+        }
+        if (cpu->oracle != NULL && is_replay_Oracle(cpu->oracle)){
+            /**
+             * For Belady optimal page replacement, the order is based on 
+             * when a process runs next, the furthest in the future first
+             */
+            prio = PRIO_NEXT_USE;
         }
+        cpu->memory->evict_index = new_indexed_queue(prio);
     }
-    fprintf(stdout, "]\n");
+
+    return cpu->memory->evict_index;
 }
 
 
 /**
- * @brief  Print the evicted message
+ * @brief  Simulate buddy allocation before a process can be executed on the 
+ *         CPU. A process is allocated one block of the smallest power-of-two 
+ *         number of pages which fits all of its pages, and whole processes 
+ *         are evicted (as swapping) until a free block can be allocated.
+ *         If a process needs more pages than the largest block of the 
+ *         memory, it is allocated the largest block, and the pages which 
+ *         do not fit are page faults (as virtual memory)
  * 
+ * @param  mem_alloc_f  a memory allocation method flag
  * @param  cpu          a CPUInfo data
- * @param  page_list    a evict page list
- * @param  p_size       the size of the pages be evicted
- */ 
-void print_evicted(CPUInfo *cpu, long long int *page_list, long long int p_size){
-    fprintf(stdout, "%lld, EVICTED, mem-addresses=[", cpu->curr_time);
+ * @param  p            a ProcessInfo data
+ */
+void buddy_alloc_func(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p){
+
+    MemoryInfo *memory = cpu->memory;
+    long long int total_require_page = get_require_page(memory, p);
+    long long int block_page = get_block_page(memory->buddy, 
+                                                total_require_page);
+    long long int num_use = total_require_page;
+    if (num_use > block_page){
+        num_use = block_page;
+    }
 
-    for (long long int i = 0; i < p_size; i++){
-        fprintf(stdout, "%lld", page_list[i]);
-        if (i != p_size - 1){
-            fprintf(stdout, ",");
+    // If the block of the process is in memory already, it can be executed
+    p->load_time = 0;
+    if (p->num_page_in_mem == 0 && total_require_page > 0){
+
+        // Evict processes until a block can be allocated
+        if (need_evict(memory, p, block_page)){
+            evcit(mem_alloc_f, cpu, p, block_page);
+        }
+
+        // Allocate the block, all of its pages belong to the process
+        long long int start = alloc_block(memory->buddy, block_page);
+        assert(start != INVALID);
+        claim_range(memory, p, start, block_page);
+        merge_pages(&p->page_list, memory->claim_list, block_page);
+        record_fragmentation(memory);
+        memory->total_block_page += block_page;
+        memory->total_use_page += num_use;
+
+        // Only the pages used by the process are loaded
+        p->load_time = get_tier_load_time(memory, p, num_use);
+        if (memory->swap != NULL){
+            p->load_time += flush_swap(memory->swap);
         }
+        memory->num_page_load += num_use;
+        p->num_page_in_mem = block_page;
+
+        // Calcatue the current memory usage
+        long long int new_usage = my_ceil(100 * 
+                        (block_page * 1.0 / memory->total_page * 1.0));
+        p->mem_usage += new_usage;
+        memory->memory_use += new_usage;
     }
-    fprintf(stdout, "]\n");
-}
 
+    // Update the page fault
+    p->page_fault = total_require_page - num_use;
+    p->remaining_time += p->page_fault;
 
+    // Print the process currently execution transcript
+    print_evict_list(cpu);
+    print_mem_running(cpu, p);
+}
 
+
+/**
+ * @brief  Evict number of pages from the processes until reach the 
+ *         requirement. The pages evicted are added to the evict list of the
+ *         memory, the caller prints them with the other pages evicted for 
+ *         the same allocation
+ * 
+ * @param  mem_alloc_f  a memory allocation method flag
+ * @param  cpu          a CPUInfo data
+ * @param  p            the ProcessInfo data the pages are allocated to
+ * @param  curr_require_page    total number of page need to be evicted
+ */
+void evcit(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p, 
+            long long int curr_require_page){
+    
+    // CLOCK page replacement evicts pages instead of processes
+    if (mem_alloc_f == CL_M_FLAG){
+        clock_evict(cpu, p, curr_require_page);
+        return;
+    }
+
+    /**
+     * The eviction index keeps the processes which are not running and have
+     * pages in memory, sorted based on the page replacement in ascending 
+     * order (least-recently-executed or fewest pages in memory)
+     */
+    Queue *evict_index = get_evict_index(mem_alloc_f, cpu);
+
+    // A list to record evict pages, after the pages not printed yet
+    long long int *evict_list = cpu->memory->evict_list;
+    long long int evict_ind = cpu->memory->num_evict_list;
+
+    // Evict number of pages from the processes until reach the requirement
+    while(need_evict(cpu->memory, p, curr_require_page)){
+         
+        ProcessInfo *evict_p;
+        if (cpu->memory->adapt != NULL){
+            evict_p = get_repl_victim(cpu->memory->adapt, p);
+        } else {
+            evict_p = dequeue(evict_index);
+        }
+        
+        /**
+         * A certain number of pages need to be required, 
+         * based on how many pages it has and how many required
+         */
+        long long int num_free = evict_p->num_page_in_mem;
+        if(mem_alloc_f == VM_M_FLAG || mem_alloc_f == CM_M_FLAG
+            || mem_alloc_f == AR_M_FLAG || mem_alloc_f == LI_M_FLAG
+            || mem_alloc_f == WS_M_FLAG){
+            long long int num_short = curr_require_page 
+                                    - get_free_page(cpu->memory, p->page_ratio);
+            if(num_free >= num_short){
+                num_free = num_short;
+            }
+
+            // Huge pages are evicted whole
+            long long int evict_ratio = evict_p->page_ratio;
+            num_free = (num_free + evict_ratio - 1) / evict_ratio * evict_ratio;
+        }
+
+        // evict pages
+        record_evict(cpu->memory, evict_p, num_free);
+        evict_ind = free_page(cpu, evict_p, evict_list, num_free, evict_ind);
+
+        /**
+         * The process is still a candidate if it has pages left in memory.
+         * For ARC and LIRS, it keeps its place until it has none
+         */
+        if (cpu->memory->adapt != NULL){
+            if (evict_p->num_page_in_mem == 0){
+                evict_repl(cpu->memory->adapt, evict_p);
+            }
+        } else if (evict_p->num_page_in_mem > 0){
+            enqueue(evict_index, evict_p);
+        }
+    }
+
+    cpu->memory->num_evict_list = evict_ind;
+}
+
+
+/**
+ * @brief  Evict pages by CLOCK (second-chance) page replacement until reach
+ *         the requirement. The clock hand goes around the pages, a page 
+ *         with its reference bit set has the bit cleared and is skipped, 
+ *         otherwise it is evicted. Each page is passed at most twice, and 
+ *         the page lists of the processes losing pages are filtered once 
+ *         after all pages are evicted, when each run of contiguous pages 
+ *         evicted is added to the holes. The pages evicted are added to 
+ *         the evict list of the memory
+ * 
+ * @param  cpu                  a CPUInfo data
+ * @param  p                    the ProcessInfo data the pages are allocated 
+ *                              to, its pages are not evicted
+ * @param  curr_require_page    total number of page need to be evicted
+ * @return long long int        number of pages evicted
+ */
+long long int clock_evict(CPUInfo *cpu, ProcessInfo *p, 
+                            long long int curr_require_page){
+
+    MemoryInfo *memory = cpu->memory;
+    long long int *evict_list = memory->evict_list;
+    long long int first = memory->num_evict_list;
+    long long int evict_ind = first;
+    long long int num_step = 0;
+
+    while(curr_require_page > memory->num_holes){
+
+        /**
+         * Error if the pages can not be evicted, each page can be evicted 
+         * is evicted within two sweeps as the first sweep clears its 
+         * reference bit
+         */
+        assert(num_step < 2 * memory->total_page);
+        num_step ++;
+
+        long long int ind = memory->clock_hand;
+        memory->clock_hand = (ind + 1) % memory->total_page;
+
+        /**
+         * Skip the empty pages, the pages of the process to allocate, 
+         * the pages being loaded by the I/O device, the pages of the
+         * processes running on other cores and of the shared segments 
+         * in use
+         */
+        if ((memory->free_map[ind / BITS_PER_WORD] 
+                >> (ind % BITS_PER_WORD)) & 1){
+            continue;
+        }
+        ProcessInfo *owner = &memory->processes[memory->owner_lst[ind]];
+        if (owner == p || owner->io_done_time != INVALID 
+            || owner->core_id != INVALID || owner->share_ref > 0){
+            continue;
+        }
+
+        // Give a referenced page a second chance
+        if (memory->ref_bit[ind]){
+            memory->ref_bit[ind] = 0;
+            continue;
+        }
+
+        // Evict the page, the owner keeps it in its page list until filtered
+        record_evict(memory, owner, 1);
+        free_frame(memory, ind);
+        owner->num_page_in_mem --;
+        evict_list[evict_ind] = ind;
+        evict_ind ++;
+    }
+
+    // Add each run of contiguous pages evicted to the holes
+    long long int run_start = INVALID;
+    long long int run_length = 0;
+    for (long long int i = first; i < evict_ind; i++){
+        if (run_length > 0 && evict_list[i] != run_start + run_length){
+            free_extent(memory->holes, run_start, run_length);
+            run_length = 0;
+        }
+        if (run_length == 0){
+            run_start = evict_list[i];
+        }
+        run_length ++;
+    }
+    if (run_length > 0){
+        free_extent(memory->holes, run_start, run_length);
+    }
+
+    /**
+     * Remove the evicted pages from the page list of each process losing 
+     * pages, the page list is longer than its number of pages in memory 
+     * until it is filtered
+     */
+    for (long long int i = first; i < evict_ind; i++){
+        long long int owner_ind = memory->owner_lst[evict_list[i]];
+        ProcessInfo *owner = &memory->processes[owner_ind];
+        if (owner->page_list.size == owner->num_page_in_mem){
+            continue;
+        }
+
+        long long int num_free = filter_pages(&owner->page_list, 
+                                                memory->free_map);
+        if (owner->num_page_in_mem == 0){
+            clear_PageList(&owner->page_list);
+        }
+
+        // Update the memory usage of a process after some pages be freed
+        long long int free_usage = my_ceil(100 * 
+                                (num_free * 1.0 / memory->total_page * 1.0));
+        owner->mem_usage -= free_usage;
+        memory->memory_use -= free_usage;
+    }
+    for (long long int i = first; i < evict_ind; i++){
+        memory->owner_lst[evict_list[i]] = INVALID;
+    }
+
+    memory->num_evict_list = evict_ind;
+    return evict_ind - first;
+}
+
+
+/**
+ * @brief  Free a page in the memory without removing it from the page list
+ *         of the process occupying it or adding it to the holes
+ * 
+ * @param  memory   a MemoryInfo data
+ * @param  ind      a page
+ */
+void free_frame(MemoryInfo *memory, long long int ind){
+    memory->free_map[ind / BITS_PER_WORD] |= 1ULL << (ind % BITS_PER_WORD);
+    memory->ref_bit[ind] = 0;
+    memory->num_holes ++;
+}
+
+
+/**
+ * @brief  Set the reference bits of all pages of a process, when it runs
+ * 
+ * @param  memory   a MemoryInfo data
+ * @param  p        a ProcessInfo data
+ */
+void reference_pages(MemoryInfo *memory, ProcessInfo *p){
+    for (long long int i = 0; i < p->num_page_in_mem; i++){
+        memory->ref_bit[get_page(&p->page_list, i)] = 1;
+    }
+}
+
+
+/**
+ * @brief  Evict the pages of processes not run within the working-set 
+ *         window, they are not in the working set of the memory. The pages
+ *         evicted are added to the evict list of the memory, and printed 
+ *         with the pages evicted for the same allocation
+ * 
+ * @param  mem_alloc_f  a memory allocation method flag
+ * @param  cpu          a CPUInfo data
+ */
+void trim_working_set(char mem_alloc_f, CPUInfo *cpu){
+
+    Queue *evict_index = get_evict_index(mem_alloc_f, cpu);
+    long long int window = get_window(cpu->memory->load_ctrl);
+    long long int *evict_list = cpu->memory->evict_list;
+    long long int evict_ind = cpu->memory->num_evict_list;
+
+    // The eviction index is ordered by last execution time
+    while (get_queue_size(evict_index) > 0 
+            && get_queue_point(evict_index, 0)->last_execution_time 
+                <= cpu->curr_time - window){
+        ProcessInfo *evict_p = dequeue(evict_index);
+        record_evict(cpu->memory, evict_p, evict_p->num_page_in_mem);
+        evict_ind = free_page(cpu, evict_p, evict_list, 
+                                evict_p->num_page_in_mem, evict_ind);
+    }
+    cpu->memory->num_evict_list = evict_ind;
+}
+
+
+/**
+ * @brief  Return if a process had page faults within the working-set 
+ *         window, so its page fault frequency is high
+ * 
+ * @param  mem_alloc_f  a memory allocation method flag
+ * @param  cpu          a CPUInfo data
+ * @param  p            a ProcessInfo data
+ * @return int          1 if its page fault frequency is high, 0 otherwise
+ */
+int is_high_fault_rate(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p){
+
+    // The pages being loaded may split the huge pages of the memory
+    if (p->page_ratio > 1 && cpu->memory->num_page_io > 0){
+        return 0;
+    }
+    return mem_alloc_f == WS_M_FLAG && p->last_fault_time != INVALID
+            && cpu->curr_time - p->last_fault_time 
+                < get_window(cpu->memory->load_ctrl);
+}
+
+
+/**
+ * @brief  Return if pages need to be evicted to allocate a number of pages.
+ *         For buddy allocation, it is if no free block can fit the pages, 
+ *         otherwise it is if there are not enough empty pages in whole 
+ *         pages of the page size of the process
+ * 
+ * @param  memory               a MemoryInfo data
+ * @param  p                    the ProcessInfo data the pages are allocated to
+ * @param  curr_require_page    number of pages need to be allocated
+ * @return int                  1 if pages need to be evicted, 0 otherwise
+ */
+int need_evict(MemoryInfo *memory, ProcessInfo *p, 
+                long long int curr_require_page){
+    if (memory->buddy != NULL){
+        return !can_alloc_block(memory->buddy, curr_require_page);
+    }
+    return curr_require_page > get_free_page(memory, p->page_ratio);
+}
+
+
+/**
+ * @brief  Return the number of pages a process requires. A process at least
+ *         a huge page large uses huge pages, its requirement is rounded up 
+ *         to whole huge pages, otherwise to whole pages. It is calculated 
+ *         once, when the process is allocated first time
+ * 
+ * @param  memory           a MemoryInfo data
+ * @param  p                a ProcessInfo data
+ * @return long long int    number of pages required
+ */
+long long int get_require_page(MemoryInfo *memory, ProcessInfo *p){
+
+    if (p->total_require_page == INVALID){
+        if (memory->huge_ratio > 1 
+            && p->mem_size_req >= memory->huge_ratio * memory->page_size){
+            p->page_ratio = memory->huge_ratio;
+        }
+        long long int page_kb = p->page_ratio * memory->page_size;
+        p->total_require_page = (p->mem_size_req + page_kb - 1) / page_kb 
+                                * p->page_ratio;
+
+        /**
+         * A process of a share group shares the pages of its shared segment,
+         * if it fits in the memory with the minimum pages to execute
+         */
+        if (p->share != NULL){
+            long long int num_share = get_require_page(memory, p->share);
+            if (!memory->is_share 
+                || num_share + MIN_EXE_PAGE > memory->total_page){
+                p->share = NULL;
+            } else {
+                p->num_share_page = num_share;
+                p->total_require_page -= num_share;
+            }
+        }
+    }
+    return p->total_require_page;
+}
+
+
+/**
+ * @brief  Return the time to load a number of pages of a page size, each 
+ *         page takes a setup time and a transfer time proportional to its 
+ *         size, so a 4KB page takes 2 seconds
+ * 
+ * @param  memory           a MemoryInfo data
+ * @param  page_ratio       number of pages in a page of the page size
+ * @param  num_page         number of pages, a multiple of the page ratio
+ * @return long long int    the loading time
+ */
+long long int get_load_time(MemoryInfo *memory, long long int page_ratio, 
+                            long long int num_page){
+    long long int num_load = num_page / page_ratio;
+    long long int num_kb = num_page * memory->page_size;
+    return num_load * LOAD_SETUP_TIME 
+            + (num_kb + KB_PER_LOAD_TIME - 1) / KB_PER_LOAD_TIME;
+}
+
+
+/**
+ * @brief  Return the time to load a number of pages of a process from the
+ *         tiers. Its pages in the compressed pool are decompressed, which 
+ *         takes no setup time and is faster than reading the others from 
+ *         the disk. Without a compressed pool, all pages are read from disk
+ * 
+ * @param  memory           a MemoryInfo data
+ * @param  p                a ProcessInfo data
+ * @param  num_page         number of pages, a multiple of its page ratio
+ * @return long long int    the loading time
+ */
+long long int get_tier_load_time(MemoryInfo *memory, ProcessInfo *p, 
+                                    long long int num_page){
+
+    if (memory->tier == NULL){
+        return get_disk_load_time(memory, p, num_page);
+    }
+
+    // Only whole huge pages are taken from the pool
+    long long int num_pool = get_pool_page(memory->tier, p);
+    if (num_pool > num_page){
+        num_pool = num_page;
+    }
+    num_pool = num_pool / p->page_ratio * p->page_ratio;
+    promote_page(memory->tier, p, num_page, num_pool);
+
+    long long int pool_kb = num_pool * memory->page_size;
+    return (pool_kb + KB_PER_POOL_LOAD_TIME - 1) / KB_PER_POOL_LOAD_TIME 
+            + get_disk_load_time(memory, p, num_page - num_pool);
+}
+
+
+/**
+ * @brief  Return the time to load a number of pages of a process from the 
+ *         disk, based on its extents on the swap device if there is one
+ * 
+ * @param  memory           a MemoryInfo data
+ * @param  p                a ProcessInfo data
+ * @param  num_page         number of pages, a multiple of its page ratio
+ * @return long long int    the loading time
+ */
+long long int get_disk_load_time(MemoryInfo *memory, ProcessInfo *p, 
+                                    long long int num_page){
+    if (memory->swap != NULL){
+        return read_swap(memory->swap, p, num_page, memory->page_size);
+    }
+    return get_load_time(memory, p->page_ratio, num_page);
+}
+
+
+/**
+ * @brief  Map the shared segment of a process which starts running, and 
+ *         return the time to load its pages not in memory. The segment can
+ *         not be evicted while a process uses it
+ * 
+ * @param  mem_alloc_f      a memory allocation method flag
+ * @param  cpu              a CPUInfo data
+ * @param  p                a ProcessInfo data
+ * @return long long int    the loading time
+ */
+long long int map_shared(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p){
+
+    MemoryInfo *memory = cpu->memory;
+    ProcessInfo *share = p->share;
+    if (share->share_ref == 0){
+        remove_queue_point(get_evict_index(mem_alloc_f, cpu), share);
+    }
+    share->share_ref++;
+
+    long long int num_page = get_require_page(memory, share) 
+                                - share->num_page_in_mem;
+    if (num_page == 0){
+        return 0;
+    }
+    if (need_evict(memory, share, num_page)){
+        evcit(mem_alloc_f, cpu, share, num_page);
+    }
+
+    claim_pages(memory, share, num_page);
+    merge_pages(&share->page_list, memory->claim_list, num_page);
+    record_fragmentation(memory);
+    memory->num_page_load += num_page;
+    memory->num_share_load += num_page;
+    share->num_page_in_mem += num_page;
+
+    long long int new_usage = my_ceil(100 * 
+                            (num_page * 1.0 / memory->total_page * 1.0));
+    share->mem_usage += new_usage;
+    memory->memory_use += new_usage;
+
+    return get_tier_load_time(memory, share, num_page);
+}
+
+
+/**
+ * @brief  Unmap the shared segment of a process which stops running. When 
+ *         no process uses the segment, it is a candidate for eviction, or 
+ *         it is freed if all processes of the group have left the group, 
+ *         its pages are added to the evict list of the memory
+ * 
+ * @param  mem_alloc_f  a memory allocation method flag
+ * @param  cpu          a CPUInfo data
+ * @param  p            a ProcessInfo data
+ * @param  is_leave     whether the process leaves the group, it has 
+ *                      finished or copied all its shared pages
+ */
+void unmap_shared(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p, 
+                    int is_leave){
+
+    ProcessInfo *share = p->share;
+    assert(share->share_ref > 0);
+    share->share_ref--;
+    share->last_execution_time = p->last_execution_time;
+    if (is_leave){
+        share->num_share_member--;
+    }
+    if (share->share_ref > 0 || share->num_page_in_mem == 0){
+        return;
+    }
+
+    if (share->num_share_member == 0){
+        MemoryInfo *memory = cpu->memory;
+        memory->num_evict_list = free_page(cpu, share, memory->evict_list, 
+                            share->num_page_in_mem, memory->num_evict_list);
+    } else {
+        enqueue(get_evict_index(mem_alloc_f, cpu), share);
+    }
+}
+
+
+/**
+ * @brief  Return the number of empty pages can be allocated in whole pages 
+ *         of a page size, they are all empty pages for the base page size,
+ *         and the pages of the empty huge pages otherwise
+ * 
+ * @param  memory           a MemoryInfo data
+ * @param  page_ratio       number of pages in a page of the page size
+ * @return long long int    number of pages can be allocated
+ */
+long long int get_free_page(MemoryInfo *memory, long long int page_ratio){
+
+    if (page_ratio == 1){
+        return memory->num_holes;
+    }
+
+    long long int num_huge = 0;
+    long long int start = find_huge_page(memory, page_ratio, 0);
+    while (start != INVALID){
+        num_huge++;
+        start = find_huge_page(memory, page_ratio, start + page_ratio);
+    }
+    return num_huge * page_ratio;
+}
+
+
+/**
+ * @brief  Return the first empty huge page from a page. A huge page is a 
+ *         run of a power-of-two number of pages aligned to its size, so 
+ *         the free page bitmap is checked a word (or part of one) at a time
+ * 
+ * @param  memory           a MemoryInfo data
+ * @param  page_ratio       number of pages in a huge page
+ * @param  from             the page to search from, aligned to a huge page
+ * @return long long int    the first page of the empty huge page,
+ *                          INVALID if there is none
+ */
+long long int find_huge_page(MemoryInfo *memory, long long int page_ratio, 
+                                long long int from){
+
+    unsigned long long int *free_map = memory->free_map;
+    for (long long int start = from; start + page_ratio <= memory->total_page; 
+            start += page_ratio){
+
+        // A huge page within a word is empty if all its bits are set
+        if (page_ratio < BITS_PER_WORD){
+            unsigned long long int mask = (1ULL << page_ratio) - 1;
+            if (((free_map[start / BITS_PER_WORD] 
+                    >> (start % BITS_PER_WORD)) & mask) == mask){
+                return start;
+            }
+            continue;
+        }
+
+        // A huge page of whole words is empty if all the words are full
+        long long int w = start / BITS_PER_WORD;
+        long long int end = (start + page_ratio) / BITS_PER_WORD;
+        while (w < end && free_map[w] == ~0ULL){
+            w++;
+        }
+        if (w == end){
+            return start;
+        }
+    }
+    return INVALID;
+}
+
+
+/**
+ * @brief  Allocate a number of pages in the lowest empty huge pages to a 
+ *         process, and record the pages in the claim list of the memory 
+ *         in ascending order
+ * 
+ * @param  memory       a MemoryInfo data
+ * @param  p            a ProcessInfo data
+ * @param  num_page     number of pages, a multiple of its page ratio
+ */
+void claim_huge_pages(MemoryInfo *memory, ProcessInfo *p, 
+                        long long int num_page){
+
+    long long int page_ratio = p->page_ratio;
+    long long int num_claim = 0;
+    long long int start = 0;
+    while (num_claim < num_page){
+        start = find_huge_page(memory, page_ratio, start);
+        assert(start != INVALID);
+
+        for (long long int ind = start; ind < start + page_ratio; ind++){
+            memory->free_map[ind / BITS_PER_WORD] &= 
+                                        ~(1ULL << (ind % BITS_PER_WORD));
+            memory->owner_lst[ind] = p - memory->processes;
+            memory->claim_list[num_claim] = ind;
+            num_claim++;
+        }
+        claim_extent(memory->holes, start, page_ratio);
+        start += page_ratio;
+    }
+
+    memory->num_holes -= num_claim;
+}
+
+
+/**
+ * @brief  Record a number of pages of a process are evicted, a huge page is
+ *         counted once for statistics. With a compressed pool, the pages 
+ *         are moved into it, and with a swap device, the dirty pages are 
+ *         written to it
+ * 
+ * @param  memory       a MemoryInfo data
+ * @param  p            a ProcessInfo data
+ * @param  num_page     number of pages evicted
+ */
+void record_evict(MemoryInfo *memory, ProcessInfo *p, long long int num_page){
+    memory->num_evict += num_page / p->page_ratio;
+    if (memory->tier != NULL){
+        demote_page(memory->tier, p, num_page);
+    }
+    if (memory->swap != NULL){
+        write_swap(memory->swap, p, num_page, memory->page_size);
+    }
+}
+
+
+/**
+ * @brief  Compare two long long integer values, a and b
+ * 
+ * @param  a        a long long int value
+ * @param  b        a long long int value
+ * @return int      0 if they are equal
+ *                  1 if a > b
+ *                  -1 if a < b
+ */
+int long_int_comparator(const void * a, const void *b)
+{
+    const long long int ia = *(const long long int *)a;
+    const long long int ib = *(const long long int *)b;
+
+	if (ia == ib)
+		return 0;
+	if (ia > ib)
+		return 1;
+	return -1;
+}
+
+/**
+ * @brief  Allocate a number of empty pages to a process. If a contiguous 
+ *         placement method is chosen and a hole can fit all pages, the pages
+ *         are from that hole. Otherwise they are the empty pages with the 
+ *         lowest addresses, the free page bitmap is scanned a word (64 pages) 
+ *         at a time, so finding the pages takes O(total pages / 64) time.
+ *         The pages allocated are recorded in the claim list of the memory
+ *         in ascending order
+ * 
+ * @param  memory       a MemoryInfo data
+ * @param  p            a ProcessInfo data
+ * @param  num_page     number of pages need to be allocated
+ */
+void claim_pages(MemoryInfo *memory, ProcessInfo *p, long long int num_page){
+
+    if (p->page_ratio > 1){
+        claim_huge_pages(memory, p, num_page);
+        return;
+    }
+    
+    long long int start = find_placement(memory, num_page);
+    if (start != INVALID){
+        claim_range(memory, p, start, num_page);
+        return;
+    }
+
+    long long int num_claim = 0;
+    for (long long int w = 0; w < memory->num_words; w++){
+        if (num_claim == num_page){
+            break;
+        }
+
+        // Take the empty pages of this word from the lowest address
+        unsigned long long int word = memory->free_map[w];
+        while (word != 0 && num_claim < num_page){
+            long long int ind = w * BITS_PER_WORD + __builtin_ctzll(word);
+            word &= word - 1;
+
+            memory->owner_lst[ind] = p - memory->processes;
+            memory->claim_list[num_claim] = ind;
+            num_claim ++;
+        }
+        memory->free_map[w] = word;
+    }
+
+    memory->num_holes -= num_claim;
+
+    // Remove each run of contiguous pages allocated from the holes
+    long long int run_start = 0;
+    for (long long int i = 1; i <= num_claim; i++){
+        if (i == num_claim 
+            || memory->claim_list[i] != memory->claim_list[i - 1] + 1){
+            claim_extent(memory->holes, memory->claim_list[run_start], 
+                            i - run_start);
+            run_start = i;
+        }
+    }
+}
+
+
+/**
+ * @brief  Find a hole for a number of pages based on the contiguous 
+ *         placement method (first-fit, best-fit or next-fit)
+ * 
+ * @param  memory           a MemoryInfo data
+ * @param  num_page         number of pages
+ * @return long long int    the start page of the hole, INVALID (-1) if 
+ *                          no placement method is chosen or no hole can fit
+ */
+long long int find_placement(MemoryInfo *memory, long long int num_page){
+
+    if (memory->placement == FF_L_FLAG){
+        return find_first_fit(memory->holes, num_page);
+    } else if (memory->placement == BF_L_FLAG){
+        return find_best_fit(memory->holes, num_page);
+    } else if (memory->placement == NF_L_FLAG){
+        return find_next_fit(memory->holes, num_page, memory->next_fit);
+    }
+    return INVALID;
+}
+
+
+/**
+ * @brief  Allocate a range of empty pages to a process, and record the 
+ *         pages in the claim list of the memory in ascending order
+ * 
+ * @param  memory       a MemoryInfo data
+ * @param  p            a ProcessInfo data
+ * @param  start        the start page of the range
+ * @param  num_page     number of pages of the range
+ */
+void claim_range(MemoryInfo *memory, ProcessInfo *p, 
+                    long long int start, long long int num_page){
+
+    for (long long int i = 0; i < num_page; i++){
+        long long int ind = start + i;
+        memory->free_map[ind / BITS_PER_WORD] &= 
+                                            ~(1ULL << (ind % BITS_PER_WORD));
+        memory->owner_lst[ind] = p - memory->processes;
+        memory->claim_list[i] = ind;
+    }
+
+    memory->num_holes -= num_page;
+    claim_extent(memory->holes, start, num_page);
+
+    // Next-fit starts from the page after this range next time
+    memory->next_fit = start + num_page;
+}
+
+
+/**
+ * @brief  Record the hole count and the largest hole for fragmentation 
+ *         statistics
+ * 
+ * @param  memory       a MemoryInfo data
+ */
+void record_fragmentation(MemoryInfo *memory){
+    long long int hole_count = get_num_extent(memory->holes);
+    long long int largest_hole = get_largest_extent(memory->holes);
+
+    memory->num_frag_sample ++;
+    memory->total_hole_count += hole_count;
+    memory->total_largest_hole += largest_hole;
+    if (hole_count > memory->max_hole_count){
+        memory->max_hole_count = hole_count;
+    }
+    if (largest_hole < memory->min_largest_hole){
+        memory->min_largest_hole = largest_hole;
+    }
+}
+
+
+/**
+ * @brief  Free the pages in the memory that previously occupied by a process
+ * 
+ * @param  cpu              a CPUInfo data
+ * @param  p                a ProcessInfo data
+ * @param  page_list        a page list record which pages be freed
+ * @param  num_free         number of pages that needed free
+ * @param  start            index of the page list before new free be made
+ * @return long long int    index of the free page list after new free be made
+ */
+long long int free_page(CPUInfo *cpu, ProcessInfo *p, long long int *page_list, 
+                    long long int num_free, long long int start){
+    
+    /**
+     * Free the pages from the memory and record to free page list if necessary.
+     * The pages are in ascending order, each run of contiguous pages is 
+     * added to the holes
+     */
+    long long int block_start = INVALID;
+    if (num_free > 0){
+        block_start = get_page(&p->page_list, 0);
+    }
+    long long int run_start = INVALID;
+    long long int run_length = 0;
+    for(long long int i = 0; i < num_free; i++){
+        long long int ind = pop_page(&p->page_list);
+        cpu->memory->owner_lst[ind] = INVALID;
+        cpu->memory->ref_bit[ind] = 0;
+        cpu->memory->free_map[ind / BITS_PER_WORD] |= 
+                                            1ULL << (ind % BITS_PER_WORD);
+
+        if (run_length > 0 && ind != run_start + run_length){
+            free_extent(cpu->memory->holes, run_start, run_length);
+            run_length = 0;
+        }
+        if (run_length == 0){
+            run_start = ind;
+        }
+        run_length ++;
+
+        // Record the free pages
+        if (page_list != NULL){
+            page_list[start] = ind;
+            start ++;
+        }
+    }
+
+    if (run_length > 0){
+        free_extent(cpu->memory->holes, run_start, run_length);
+    }
+
+    // Update the number of holes in memory
+    cpu->memory->num_holes += num_free;
+
+    // The pages prefetched are wasted if they are evicted before it runs
+    if (p->num_prefetch > 0){
+        long long int num_waste = num_free;
+        if (num_waste > p->num_prefetch){
+            num_waste = p->num_prefetch;
+        }
+        p->num_prefetch -= num_waste;
+        cpu->memory->num_prefetch_waste += num_waste;
+    }
+
+    /**
+     * The pages are removed from the start of the page list for a process, 
+     * update the number of it, and free the page list if it is empty
+     */
+    p->num_page_in_mem -= num_free;
+    if (p->num_page_in_mem == 0){
+        clear_PageList(&p->page_list);
+    }
+
+    // For buddy allocation, the whole block of the process is freed
+    if (cpu->memory->buddy != NULL && num_free > 0){
+        assert(p->num_page_in_mem == 0);
+        free_block(cpu->memory->buddy, block_start);
+    }
+
+    // Update the memory usage of a process after some pages be freed
+    long long int free_usage = my_ceil(100 * 
+                            (num_free * 1.0 / cpu->memory->total_page * 1.0));
+    p->mem_usage -= free_usage;
+    cpu->memory->memory_use -= free_usage;
+
+
+    // Return the current index of free page list 
+    return start;
+}
+
+/**
+ * @brief  Print a process currently execution message for unlimited memory size
+ * 
+ * @param  cpu  a CPUInfo data
+ * @param  p    a ProcessInfo data
+ */
+void print_running(CPUInfo *cpu, ProcessInfo *p){
+    if (cpu->is_quiet){
+        return;
+    }
+    fprintf(stdout, "%lld, RUNNING, id=%lld, ", cpu->curr_time, p->p_id);
+    if (cpu->num_core > 1){
+        fprintf(stdout, "core=%lld, ", p->core_id);
+    }
+    fprintf(stdout, "remaining-time=%lld\n", p->remaining_time);
+}
+
+/**
+ * @brief  Print a process currently execution message for limited memory size 
+ * 
+ * @param  cpu  a CPUInfo data 
+ * @param  p    a ProcessInfo data
+ */
+void print_mem_running(CPUInfo *cpu, ProcessInfo *p){
+    if (cpu->is_quiet){
+        return;
+    }
+
+    // The pages loaded by the I/O device are loading before it runs
+    if (cpu->io != NULL && p->load_time > 0){
+        fprintf(stdout, "%lld, LOADING, id=%lld, load-time=%lld, "
+                        "mem-usage=%d%%, mem-addresses=[",
+                        cpu->curr_time, p->p_id, p->load_time, 
+                        cpu->memory->memory_use);
+    } else {
+        fprintf(stdout, "%lld, RUNNING, id=%lld, ", cpu->curr_time, p->p_id);
+        if (cpu->num_core > 1){
+            fprintf(stdout, "core=%lld, ", p->core_id);
+        }
+        fprintf(stdout, "remaining-time=%lld, load-time=%lld, "
+                        "mem-usage=%d%%, mem-addresses=[",
+                        p->remaining_time, p->load_time, 
+                        cpu->memory->memory_use);
+    }
+
+    // The pages of the shared segment it maps are merged in order
+    long long int num_share = 0;
+    if (cpu->memory->is_share && p->share != NULL){
+        num_share = p->share->num_page_in_mem;
+    }
+    long long int i = 0;
+    long long int j = 0;
+    while (i < p->num_page_in_mem || j < num_share){
+        if (i + j > 0){
+            fprintf(stdout, ",");
+        }
+        if (j == num_share || (i < p->num_page_in_mem 
+                && get_page(&p->page_list, i) 
+                    < get_page(&p->share->page_list, j))){
+            fprintf(stdout, "%lld", get_page(&p->page_list, i));
+            i++;
+        } else {
+            fprintf(stdout, "%lld", get_page(&p->share->page_list, j));
+            j++;
+        }
+    }
+    fprintf(stdout, "]\n");
+}
+
+
+/**
+ * @brief  Print the evicted message
+ * 
+ * @param  cpu          a CPUInfo data
+ * @param  page_list    a evict page list
+ * @param  p_size       the size of the pages be evicted
+ */ 
+void print_evicted(CPUInfo *cpu, long long int *page_list, long long int p_size){
+    if (cpu->is_quiet){
+        return;
+    }
+    fprintf(stdout, "%lld, EVICTED, mem-addresses=[", cpu->curr_time);
+
+    for (long long int i = 0; i < p_size; i++){
+        fprintf(stdout, "%lld", page_list[i]);
+        if (i != p_size - 1){
+            fprintf(stdout, ",");
+        }
+    }
+    fprintf(stdout, "]\n");
+}
+
+
+/**
+ * @brief  Print the pages evicted but not printed yet in ascending order in 
+ *         one evicted message, and empty the evict list. All pages evicted 
+ *         for one allocation or finish are printed together, so two evicted
+ *         messages are never printed one after another
+ * 
+ * @param  cpu  a CPUInfo data
+ */
+void print_evict_list(CPUInfo *cpu){
+
+    MemoryInfo *memory = cpu->memory;
+    if (memory->num_evict_list == 0){
+        return;
+    }
+    qsort(memory->evict_list, memory->num_evict_list, sizeof(long long int), 
+            long_int_comparator);
+    print_evicted(cpu, memory->evict_list, memory->num_evict_list);
+    memory->num_evict_list = 0;
+}
+
+
+/**
+ * @brief  Print the suspended message
+ * 
+ * @param  cpu  a CPUInfo data
+ * @param  p    a ProcessInfo data
+ */
+void print_suspended(CPUInfo *cpu, ProcessInfo *p){
+    if (cpu->is_quiet){
+        return;
+    }
+    fprintf(stdout, "%lld, SUSPENDED, id=%lld\n", cpu->curr_time, p->p_id);
+}
+
+
+/**
+ * @brief  Print the prefetched message
+ * 
+ * @param  cpu          a CPUInfo data
+ * @param  p            a ProcessInfo data
+ * @param  page_list    a prefetched page list
+ * @param  p_size       the size of the pages be prefetched
+ */
+void print_prefetched(CPUInfo *cpu, ProcessInfo *p, 
+                        long long int *page_list, long long int p_size){
+    if (cpu->is_quiet){
+        return;
+    }
+    fprintf(stdout, "%lld, PREFETCHED, id=%lld, mem-addresses=[", 
+            cpu->curr_time, p->p_id);
+    for (long long int i = 0; i < p_size; i++){
+        fprintf(stdout, "%lld", page_list[i]);
+        if (i != p_size - 1){
+            fprintf(stdout, ",");
+        }
+    }
+    fprintf(stdout, "]\n");
+}
@@ -21,12 +21,37 @@
 // == | Module Functions
 // ============================================================================
 // Simulate memory allocation before a process can be executed on the CPU
-void mem_alloc_func(char mem_alloc_f, Queue *queue, 
-                    CPUInfo *cpu, ProcessInfo *p);
+void mem_alloc_func(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p);
+
+// Record a process which stops running before it finishes for eviction
+void mem_suspend_func(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p);
+
+// Prefetch pages of the next waiting processes while a process executes
+void mem_prefetch_func(char mem_alloc_f, CPUInfo *cpu, 
+                        Queue *waiting_queue, long long int exe_time);
+
+// Return if a process can run now, otherwise it is suspended
+int mem_admit_func(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p);
+
+// Return if the memory is thrashing, so no suspended process is resumed
+int is_mem_thrashing(char mem_alloc_f, CPUInfo *cpu);
+
+// Return if a process can be allocated while other processes are loading
+// or running on other cores
+int mem_can_load_func(char mem_alloc_f, CPUInfo *cpu, ProcessInfo *p);
+
+// Record the pages of a process are being loaded by the I/O device
+void mem_load_func(CPUInfo *cpu, ProcessInfo *p);
+
+// Record a process stops running on a core, its pages can be evicted again
+void mem_release_func(CPUInfo *cpu, ProcessInfo *p);
+
+// Record the pages of a process are loaded, and it is executed
+void mem_loaded_func(CPUInfo *cpu, ProcessInfo *p);
 
 // Print the process finish message 
 void print_finished(char mem_alloc_f, CPUInfo *cpu, 
-                    ProcessInfo *p, Queue *queue);
+                    ProcessInfo *p, long long int proc_remaining);
 
 
 #endif
\ No newline at end of file
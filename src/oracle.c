@@ -0,0 +1,314 @@
+/**
+ * @file      oracle.c
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Implementation of Oracle module, the future execution order of 
+ *            processes for Belady optimal page replacement. It includes
+ *              1. creating and destroying an oracle
+ *              2. recording the order processes run in the first pass
+ *              3. replaying the order, giving each process when it runs next
+ *
+ *            The processes are identified by their index in the arena, so 
+ *            the same trace read again has the same processes. When 
+ *            replaying, the k-th time a process runs, it runs next at the 
+ *            position of its (k+1)-th run in the recorded order. A shared 
+ *            segment runs whenever a process of its group runs
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#include "oracle.h"
+#include "utilities.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+// ============================================================================
+// == | Constant Definitions 
+// ============================================================================
+#define INITIAL_CAPACITY        64
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+/**
+ * @brief  An oracle records the processes of the arena and the number of 
+ *         them, the arena index of the process of each run in order, 
+ *         the number of runs and its capacity, and whether it is replaying.
+ *         When replaying, it records the positions of the runs of each 
+ *         process in order, where the runs of each process start,
+ *         and the number of times each process has run
+ */
+struct oracle {
+    ProcessInfo *processes;
+    long long int num_process;
+
+    long long int *order;
+    long long int num_dispatch;
+    long long int capacity;
+
+    int is_replay;
+    long long int *pos_lst;
+    long long int *pos_start;
+    long long int *num_run;
+};
+
+
+// ============================================================================
+// == | Function Prototypes
+// ============================================================================
+// Allocate a list of a number of long long integers
+long long int *new_oracle_list(long long int size);
+
+// Record a process runs once more, and give it when it runs next
+void advance_oracle(Oracle *oracle, ProcessInfo *p);
+
+// Give a process the position of its next run in the recorded order
+void set_next_use(Oracle *oracle, ProcessInfo *p);
+
+// Return the arena index of the shared segment of a process, INVALID if none
+long long int get_share_index(Oracle *oracle, long long int ind);
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+/**
+ * @brief  Create a new Oracle recording the order of processes from an arena
+ * 
+ * @param  arena        a ProcessArena data
+ * @return Oracle*      return a pointer to the new Oracle
+ */
+Oracle *new_Oracle(ProcessArena *arena){
+
+    Oracle *oracle = (Oracle *)malloc(sizeof *oracle);
+    if (oracle == NULL) {
+        fprintf(stderr, "Error: new_Oracle() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Initalise value of the Oracle
+    oracle->processes = arena->processes;
+    oracle->num_process = arena->size;
+    oracle->order = new_oracle_list(INITIAL_CAPACITY);
+    oracle->num_dispatch = INITIAL;
+    oracle->capacity = INITIAL_CAPACITY;
+    oracle->is_replay = 0;
+    oracle->pos_lst = NULL;
+    oracle->pos_start = NULL;
+    oracle->num_run = NULL;
+
+    return oracle;
+}
+
+
+/**
+ * @brief  Destroy and free the memory associated with an Oracle
+ * 
+ * @param  oracle   an Oracle
+ */
+void free_Oracle(Oracle *oracle){
+
+    // Error if the Oracle does not initalise
+    assert(oracle != NULL);
+
+    // Free the memory associated with an Oracle
+    free(oracle->order);
+    free(oracle->pos_lst);
+    free(oracle->pos_start);
+    free(oracle->num_run);
+
+    // Free the Oracle itself
+    free(oracle);
+    oracle = NULL;
+}
+
+
+/**
+ * @brief  Record a process runs. If replaying, give the process and its 
+ *         shared segment the position of their next run in the recorded 
+ *         order, NEVER_USE if they do not run again
+ * 
+ * @param  oracle   an Oracle
+ * @param  p        a ProcessInfo data going to run
+ */
+void dispatch_oracle(Oracle *oracle, ProcessInfo *p){
+
+    long long int ind = p - oracle->processes;
+    assert(ind >= 0 && ind < oracle->num_process);
+
+    if (oracle->is_replay){
+        advance_oracle(oracle, p);
+        if (p->share != NULL){
+            advance_oracle(oracle, p->share);
+        }
+        return;
+    }
+
+    // The list of runs at least doubles when it is full
+    if (oracle->num_dispatch == oracle->capacity){
+        long long int *order = new_oracle_list(2 * oracle->capacity);
+        for (long long int i = 0; i < oracle->num_dispatch; i++){
+            order[i] = oracle->order[i];
+        }
+        free(oracle->order);
+        oracle->order = order;
+        oracle->capacity *= 2;
+    }
+    oracle->order[oracle->num_dispatch] = ind;
+    oracle->num_dispatch++;
+}
+
+
+/**
+ * @brief  Replay the recorded order for the same processes from another 
+ *         arena. The positions of the runs are grouped by process 
+ *         in O(number of runs + number of processes) time
+ * 
+ * @param  oracle   an Oracle
+ * @param  arena    a ProcessArena data read from the same trace
+ */
+void replay_Oracle(Oracle *oracle, ProcessArena *arena){
+
+    // Error if the arena is not from the same trace
+    assert(!oracle->is_replay && arena->size == oracle->num_process);
+
+    oracle->processes = arena->processes;
+    oracle->is_replay = 1;
+
+    /**
+     * Count the runs of each process, and where the runs of each start. 
+     * A run of a process is also a run of its shared segment
+     */
+    long long int num_process = oracle->num_process;
+    oracle->pos_start = new_oracle_list(num_process + 1);
+    oracle->num_run = new_oracle_list(num_process);
+    for (long long int i = 0; i <= num_process; i++){
+        oracle->pos_start[i] = 0;
+    }
+    for (long long int i = 0; i < oracle->num_dispatch; i++){
+        long long int ind = oracle->order[i];
+        oracle->pos_start[ind + 1]++;
+        long long int share_ind = get_share_index(oracle, ind);
+        if (share_ind != INVALID){
+            oracle->pos_start[share_ind + 1]++;
+        }
+    }
+    for (long long int i = 0; i < num_process; i++){
+        oracle->pos_start[i + 1] += oracle->pos_start[i];
+        oracle->num_run[i] = 0;
+    }
+
+    // Place the positions of the runs of each process in order
+    oracle->pos_lst = new_oracle_list(oracle->pos_start[num_process]);
+    for (long long int i = 0; i < oracle->num_dispatch; i++){
+        long long int ind = oracle->order[i];
+        oracle->pos_lst[oracle->pos_start[ind] + oracle->num_run[ind]] = i;
+        oracle->num_run[ind]++;
+        long long int share_ind = get_share_index(oracle, ind);
+        if (share_ind != INVALID){
+            oracle->pos_lst[oracle->pos_start[share_ind] 
+                            + oracle->num_run[share_ind]] = i;
+            oracle->num_run[share_ind]++;
+        }
+    }
+
+    /**
+     * No process has run when replaying starts, so each process runs next 
+     * at its first run. A process with pages in memory before it runs, 
+     * such as prefetched pages, is then ordered by its first run
+     */
+    for (long long int i = 0; i < num_process; i++){
+        oracle->num_run[i] = 0;
+        set_next_use(oracle, &arena->processes[i]);
+    }
+}
+
+
+/**
+ * @brief  Return if an Oracle is replaying the recorded order
+ * 
+ * @param  oracle   an Oracle
+ * @return int      1 if replaying, 0 if recording
+ */
+int is_replay_Oracle(Oracle *oracle){
+    return oracle->is_replay;
+}
+
+
+// ============================================================================
+// == | Auxillary Functions 
+// ============================================================================
+/**
+ * @brief  Allocate a list of a number of long long integers
+ * 
+ * @param  size             number of long long integers
+ * @return long long int*   the list
+ */
+long long int *new_oracle_list(long long int size){
+
+    long long int *list = (long long int *)malloc(
+                            (size > 0 ? size : 1) * sizeof(long long int));
+    if (list == NULL) {
+        fprintf(stderr, "Error: new_oracle_list() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+    return list;
+}
+
+
+/**
+ * @brief  Record a process runs once more when replaying, and give it the 
+ *         position of its next run in the recorded order
+ * 
+ * @param  oracle   an Oracle
+ * @param  p        a ProcessInfo data going to run
+ */
+void advance_oracle(Oracle *oracle, ProcessInfo *p){
+
+    long long int ind = p - oracle->processes;
+    assert(ind >= 0 && ind < oracle->num_process);
+
+    oracle->num_run[ind]++;
+    set_next_use(oracle, p);
+}
+
+
+/**
+ * @brief  Give a process the position of its next run in the recorded 
+ *         order, NEVER_USE if it does not run again
+ * 
+ * @param  oracle   an Oracle
+ * @param  p        a ProcessInfo data
+ */
+void set_next_use(Oracle *oracle, ProcessInfo *p){
+
+    long long int ind = p - oracle->processes;
+    long long int next = oracle->pos_start[ind] + oracle->num_run[ind];
+    if (next < oracle->pos_start[ind + 1]){
+        p->next_use = oracle->pos_lst[next];
+    } else {
+        p->next_use = NEVER_USE;
+    }
+}
+
+
+/**
+ * @brief  Return the arena index of the shared segment of a process
+ * 
+ * @param  oracle           an Oracle
+ * @param  ind              the arena index of a process
+ * @return long long int    the arena index of its shared segment, 
+ *                          INVALID if it is not in a share group
+ */
+long long int get_share_index(Oracle *oracle, long long int ind){
+
+    ProcessInfo *share = oracle->processes[ind].share;
+    if (share == NULL){
+        return INVALID;
+    }
+    return share - oracle->processes;
+}
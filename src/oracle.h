@@ -0,0 +1,50 @@
+/**
+ * @file      oracle.h
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Oracle module, the future execution order of processes for 
+ *            Belady optimal page replacement. It includes
+ *              1. creating and destroying an oracle
+ *              2. recording the order processes run in the first pass
+ *              3. replaying the order, giving each process when it runs next
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#ifndef ORACLE_H
+#define ORACLE_H
+
+#include "processInfo.h"
+
+
+// ============================================================================
+// == | Constant Definitions 
+// ============================================================================
+#define NEVER_USE               __LONG_LONG_MAX__
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+typedef struct oracle Oracle;
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+// Create a new Oracle recording the order of processes from an arena
+Oracle *new_Oracle(ProcessArena *arena);
+
+// Destroy and free the memory associated with an Oracle
+void free_Oracle(Oracle *oracle);
+
+// Record a process runs, or give it when it runs next if replaying
+void dispatch_oracle(Oracle *oracle, ProcessInfo *p);
+
+// Replay the recorded order for the same processes from another arena
+void replay_Oracle(Oracle *oracle, ProcessArena *arena);
+
+// Return if an Oracle is replaying the recorded order
+int is_replay_Oracle(Oracle *oracle);
+
+#endif
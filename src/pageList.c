@@ -0,0 +1,209 @@
+/**
+ * @file      pageList.c
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Implementation of Page list module, a growable ring buffer of 
+ *            pages in memory in ascending order. It includes
+ *              1. initialising and clearing a page list
+ *              2. getting specific position pages in the list
+ *              3. removing pages from the start of the list
+ *              4. merging new pages into the list
+ *              5. removing pages no longer owned by a process from the list
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#include "pageList.h"
+#include "utilities.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+// ============================================================================
+// == | Function Prototypes
+// ============================================================================
+// Get the buffer index of a given index of a PageList
+long long int buffer_index(PageList *list, long long int index);
+
+// Make the buffer of a PageList large enough to hold a number of pages
+void reserve_pages(PageList *list, long long int num_page);
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+/**
+ * @brief  Initialise an empty PageList, the buffer is allocated when 
+ *         the first pages are merged into it
+ * 
+ * @param  list     a PageList
+ */
+void init_PageList(PageList *list) {
+    list->pages = NULL;
+    list->capacity = INITIAL;
+    list->head = INITIAL;
+    list->size = INITIAL;
+}
+
+
+/**
+ * @brief  Remove all pages and free the buffer of a PageList
+ * 
+ * @param  list     a PageList
+ */
+void clear_PageList(PageList *list) {
+    free(list->pages);
+    init_PageList(list);
+}
+
+
+/**
+ * @brief  Get the page of a given index from a PageList
+ * 
+ * @param  list             a PageList
+ * @param  index            an index
+ * @return long long int    the page of a given index
+ */
+long long int get_page(PageList *list, long long int index) {
+
+    // Error if the index is invalid
+    assert(index >= 0 && index < list->size);
+
+    return list->pages[buffer_index(list, index)];
+}
+
+
+/**
+ * @brief  Remove and return the first (smallest) page from a PageList in O(1)
+ * 
+ * @param  list             a PageList
+ * @return long long int    the first page
+ */
+long long int pop_page(PageList *list) {
+
+    // Error if the list is empty
+    assert(list->size > 0);
+
+    long long int page = list->pages[list->head];
+    list->head = buffer_index(list, 1);
+    list->size--;
+
+    return page;
+}
+
+
+/**
+ * @brief  Merge a list of new pages in ascending order into a PageList,
+ *         keeping it in ascending order. The pages are merged from the end,
+ *         so no page is moved more than once
+ * 
+ * @param  list         a PageList
+ * @param  new_pages    a list of new pages in ascending order
+ * @param  num_new      number of new pages
+ */
+void merge_pages(PageList *list, long long int *new_pages, 
+                    long long int num_new) {
+    
+    reserve_pages(list, list->size + num_new);
+
+    long long int old_ind = list->size - 1;
+    long long int new_ind = num_new - 1;
+    long long int merge_ind = list->size + num_new - 1;
+    while (new_ind >= 0){
+        long long int page;
+        if (old_ind >= 0 && get_page(list, old_ind) > new_pages[new_ind]){
+            page = get_page(list, old_ind);
+            old_ind--;
+        } else {
+            page = new_pages[new_ind];
+            new_ind--;
+        }
+        list->pages[buffer_index(list, merge_ind)] = page;
+        merge_ind--;
+    }
+
+    list->size += num_new;
+}
+
+
+/**
+ * @brief  Remove the empty pages from a PageList, keeping the rest in 
+ *         ascending order. The pages kept are moved to the start of the 
+ *         buffer, so it takes O(number of pages) time
+ * 
+ * @param  list             a PageList
+ * @param  free_map         a free page bitmap, a set bit is an empty page
+ * @return long long int    number of pages removed
+ */
+long long int filter_pages(PageList *list, unsigned long long int *free_map) {
+
+    long long int num_keep = 0;
+    for (long long int i = 0; i < list->size; i++){
+        long long int page = get_page(list, i);
+        if (!((free_map[page / BITS_PER_WORD] >> (page % BITS_PER_WORD)) & 1)){
+            list->pages[buffer_index(list, num_keep)] = page;
+            num_keep++;
+        }
+    }
+
+    long long int num_remove = list->size - num_keep;
+    list->size = num_keep;
+
+    return num_remove;
+}
+
+
+// ============================================================================
+// == | Auxillary Functions 
+// ============================================================================
+/**
+ * @brief  Get the buffer index of a given index of a PageList
+ * 
+ * @param  list             a PageList
+ * @param  index            an index
+ * @return long long int    the buffer index
+ */
+long long int buffer_index(PageList *list, long long int index) {
+    long long int ind = list->head + index;
+    if (ind >= list->capacity){
+        ind -= list->capacity;
+    }
+    return ind;
+}
+
+
+/**
+ * @brief  Make the buffer of a PageList large enough to hold a number of 
+ *         pages. The buffer at least doubles when it grows, and the pages
+ *         are moved to the start of the new buffer
+ * 
+ * @param  list         a PageList
+ * @param  num_page     number of pages
+ */
+void reserve_pages(PageList *list, long long int num_page) {
+    if (num_page <= list->capacity){
+        return;
+    }
+
+    long long int capacity = 2 * list->capacity;
+    if (capacity < num_page){
+        capacity = num_page;
+    }
+
+    long long int *pages = (long long int *)malloc(capacity 
+                                                * (sizeof(long long int)));
+    if (pages == NULL) {
+        fprintf(stderr, "Error: reserve_pages() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+    for (long long int i = 0; i < list->size; i++){
+        pages[i] = get_page(list, i);
+    }
+
+    free(list->pages);
+    list->pages = pages;
+    list->capacity = capacity;
+    list->head = INITIAL;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file      pageList.h
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Page list module, a growable ring buffer of pages in memory
+ *            in ascending order. It includes
+ *              1. initialising and clearing a page list
+ *              2. getting specific position pages in the list
+ *              3. removing pages from the start of the list
+ *              4. merging new pages into the list
+ *              5. removing pages no longer owned by a process from the list
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#ifndef PAGELIST_H
+#define PAGELIST_H
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+typedef struct page_list PageList;
+/**
+ * @brief The PageList is a ring buffer of pages, it records the buffer and 
+ *        its capacity, the buffer index of the first page 
+ *        and the number of pages in the list.
+ */
+struct page_list {
+    long long int *pages;
+    long long int capacity;
+    long long int head;
+    long long int size;
+};
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+// Initialise an empty PageList
+void init_PageList(PageList *list);
+
+// Remove all pages and free the buffer of a PageList
+void clear_PageList(PageList *list);
+
+// Return the page of a given index from a PageList
+long long int get_page(PageList *list, long long int index);
+
+// Remove and return the first (smallest) page from a PageList
+long long int pop_page(PageList *list);
+
+// Merge a list of new pages in ascending order into a PageList
+void merge_pages(PageList *list, long long int *new_pages, 
+                    long long int num_new);
+
+// Remove the empty pages from a PageList
+long long int filter_pages(PageList *list, unsigned long long int *free_map);
+
+#endif
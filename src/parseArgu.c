@@ -6,7 +6,19 @@
  *              2. creating a new ArguInfo data
  *              3. destory and free a ArguInfo data
  *            The ArguInfo include filename, scheduling algorithm flags, and
- *            memory allocation flags, maximum memory size, quantum
+ *            memory allocation flags, maximum memory size, quantum,
+ *            contiguous placement flags, whether to compare with 
+ *            the oracle, the working-set window and page fault 
+ *            threshold percentage of the load control, whether pages
+ *            are loaded by the I/O device while other processes run, 
+ *            the number of pages and of processes to prefetch, the page
+ *            size and huge page size, the compressed pool size and 
+ *            compression ratio, the seek time and bandwidth of the swap 
+ *            device, the percentage of shared pages written each run, 
+ *            the number of CPU cores, their speeds and how processes are 
+ *            placed on them, the quantum of each level and the period 
+ *            of priority boost of the multi-level feedback queue, and the 
+ *            target latency of completely fair scheduling
  *
  * @copyright created for COMP30023 Computer System 2020
  *
@@ -27,6 +39,16 @@
 // == | Constant Definitions 
 // ============================================================================
 #define DEFAULT_QUANTAM         10 
+#define DEFAULT_WS_WINDOW       100
+#define DEFAULT_FAULT_THRESHOLD 100
+#define DEFAULT_PREFETCH_PROC   1
+#define DEFAULT_COMPRESS_RATIO  3
+#define DEFAULT_SWAP_BANDWIDTH  8
+#define DEFAULT_COW_PERCENT     10
+#define DEFAULT_NUM_CORE        1
+#define DEFAULT_NUM_LEVEL       3
+#define DEFAULT_BOOST_SLICE     10
+#define DEFAULT_LATENCY_SLICE   8
 
 
 // ============================================================================
@@ -38,6 +60,18 @@ char valid_sched_algo(char *sched_algo);
 // Validate memory allocation choice and return the corresponding flags
 char valid_mem_alloc(char *mem_alloc);
 
+// Validate contiguous placement choice and return the corresponding flags
+char valid_placement(char *placement);
+
+// Validate core placement choice and return the corresponding flags
+char valid_core_place(char *core_place);
+
+// Validate a list of positive numbers and return it
+long long int *valid_num_lst(char *nums, long long int *num);
+
+// Return if a number is a power of two
+int is_power_two(long long int num);
+
 
 // ============================================================================
 // == | Module Functions
@@ -56,7 +90,7 @@ int parseArgument(int argc, char **argv, ArguInfo *argu){
     opterr = 0;
 
     // Parsing the option argument from command line arguments
-    while ((c = getopt (argc, argv, "f:a:m:s:q:")) != INVALID){
+    while ((c = getopt (argc, argv, "f:a:m:s:q:l:Ow:t:DP:n:p:H:z:r:S:b:W:c:C:g:L:B:T:")) != INVALID){
         switch (c){
             case 'f':
                 argu->filename = optarg;
@@ -73,12 +107,144 @@ int parseArgument(int argc, char **argv, ArguInfo *argu){
             case 'q':
                 argu->quantum = atoi(optarg);
                 break;
+            case 'l':
+                argu->placement = valid_placement(optarg);
+                if (argu->placement == NULL_CHAR){
+                    return INVALID;
+                }
+                break;
+            case 'O':
+                argu->oracle = 1;
+                break;
+            case 'P':
+                argu->prefetch_page = atoi(optarg);
+                if (argu->prefetch_page <= 0){
+                    return INVALID;
+                }
+                break;
+            case 'n':
+                argu->prefetch_proc = atoi(optarg);
+                if (argu->prefetch_proc <= 0){
+                    return INVALID;
+                }
+                break;
+            case 'D':
+                argu->async_io = 1;
+                break;
+            case 'p':
+                argu->page_size = atoi(optarg);
+                if (!is_power_two(argu->page_size)){
+                    return INVALID;
+                }
+                break;
+            case 'H':
+                argu->huge_size = atoi(optarg);
+                break;
+            case 'z':
+                argu->pool_size = atoi(optarg);
+                if (argu->pool_size <= 0){
+                    return INVALID;
+                }
+                break;
+            case 'r':
+                argu->compress_ratio = atoi(optarg);
+                if (argu->compress_ratio <= 0){
+                    return INVALID;
+                }
+                break;
+            case 'S':
+                argu->seek_time = atoi(optarg);
+                if (argu->seek_time < 0){
+                    return INVALID;
+                }
+                break;
+            case 'b':
+                argu->swap_bandwidth = atoi(optarg);
+                if (argu->swap_bandwidth <= 0){
+                    return INVALID;
+                }
+                break;
+            case 'W':
+                argu->cow_percent = atoi(optarg);
+                if (argu->cow_percent < 0 || argu->cow_percent > 100){
+                    return INVALID;
+                }
+                break;
+            case 'c':
+                argu->num_core = atoi(optarg);
+                if (argu->num_core <= 0){
+                    return INVALID;
+                }
+                break;
+            case 'C':
+                free(argu->speed_lst);
+                argu->speed_lst = valid_num_lst(optarg, &argu->num_speed);
+                if (argu->speed_lst == NULL){
+                    return INVALID;
+                }
+                break;
+            case 'L':
+                free(argu->level_quantam);
+                argu->level_quantam = valid_num_lst(optarg, &argu->num_level);
+                if (argu->level_quantam == NULL 
+                    || argu->num_level > MAX_NUM_LEVEL){
+                    return INVALID;
+                }
+                break;
+            case 'B':
+                argu->boost_period = atoi(optarg);
+                if (argu->boost_period <= 0){
+                    return INVALID;
+                }
+                break;
+            case 'T':
+                argu->target_latency = atoi(optarg);
+                if (argu->target_latency <= 0){
+                    return INVALID;
+                }
+                break;
+            case 'g':
+                argu->core_place = valid_core_place(optarg);
+                if (argu->core_place == NULL_CHAR){
+                    return INVALID;
+                }
+                break;
+            case 'w':
+                argu->ws_window = atoi(optarg);
+                if (argu->ws_window <= 0){
+                    return INVALID;
+                }
+                break;
+            case 't':
+                argu->fault_threshold = atoi(optarg);
+                if (argu->fault_threshold <= 0){
+                    return INVALID;
+                }
+                break;
             case '?':
                 if (optopt == 'f' 
                     || optopt == 'a' 
                     || optopt == 'm' 
                     || optopt == 's'
-                    || optopt == 'q'){
+                    || optopt == 'q'
+                    || optopt == 'l'
+                    || optopt == 'w'
+                    || optopt == 't'
+                    || optopt == 'P'
+                    || optopt == 'n'
+                    || optopt == 'p'
+                    || optopt == 'H'
+                    || optopt == 'z'
+                    || optopt == 'r'
+                    || optopt == 'S'
+                    || optopt == 'b'
+                    || optopt == 'W'
+                    || optopt == 'c'
+                    || optopt == 'C'
+                    || optopt == 'g'
+                    || optopt == 'L'
+                    || optopt == 'B'
+                    || optopt == 'T'){
                     fprintf (stderr, 
                             "Option -%c requires an argument.\n", optopt);
                 } else if (isprint (optopt)) {
@@ -105,6 +271,127 @@ int parseArgument(int argc, char **argv, ArguInfo *argu){
         return INVALID;
     }
 
+    // The compressed pool is a part of the memory
+    if(argu->pool_size != INVALID && argu->pool_size >= argu->mem_size){
+        return INVALID;
+    }
+
+    // The compressed pool keeps the pages evicted from being written to swap
+    if(argu->pool_size != INVALID && argu->seek_time != INVALID){
+        return INVALID;
+    }
+
+    // Each core has a speed, the number of cores is the number of speeds
+    if(argu->speed_lst != NULL){
+        if (argu->num_core == DEFAULT_NUM_CORE){
+            argu->num_core = argu->num_speed;
+        } else if (argu->num_core != argu->num_speed){
+            return INVALID;
+        }
+    }
+
+    /**
+     * The multi-level feedback queue has 3 levels by default, the quantum 
+     * doubles each level down. Priority boost is every 10 times the 
+     * quantum of the bottom level by default
+     */
+    if(argu->sched_algo == ML_A_FLAG){
+        if (argu->level_quantam == NULL){
+            if (argu->quantum <= 0){
+                return INVALID;
+            }
+            argu->num_level = DEFAULT_NUM_LEVEL;
+            argu->level_quantam = (long long int *)malloc(
+                                    argu->num_level * sizeof(long long int));
+            if (argu->level_quantam == NULL) {
+                fprintf(stderr, "Error: parseArgument() malloc returned NULL\n");
+                exit(EXIT_FAILURE);
+            }
+            for (long long int i = 0; i < argu->num_level; i++){
+                argu->level_quantam[i] = argu->quantum << i;
+            }
+        }
+        if (argu->boost_period == INVALID){
+            argu->boost_period = DEFAULT_BOOST_SLICE 
+                            * argu->level_quantam[argu->num_level - 1];
+        }
+    }
+
+    /**
+     * Completely fair scheduling gives each process a time slice of the 
+     * target latency shared by the processes can run, at least the 
+     * quantum. The target latency is 8 times the quantum by default
+     */
+    if(argu->sched_algo == CF_A_FLAG){
+        if (argu->quantum <= 0){
+            return INVALID;
+        }
+        if (argu->target_latency == INVALID){
+            argu->target_latency = DEFAULT_LATENCY_SLICE * argu->quantum;
+        }
+    }
+
+    /**
+     * The working-set window and the page fault threshold are for 
+     * working-set page replacement only. The window is 100 and the 
+     * threshold is 100% by default
+     */
+    if(argu->mem_alloc == WS_M_FLAG){
+        if (argu->ws_window == INVALID){
+            argu->ws_window = DEFAULT_WS_WINDOW;
+        }
+        if (argu->fault_threshold == INVALID){
+            argu->fault_threshold = DEFAULT_FAULT_THRESHOLD;
+        }
+    } else if (argu->ws_window != INVALID || argu->fault_threshold != INVALID){
+        return INVALID;
+    }
+
+    // The I/O device overlaps loading with a single CPU only
+    if(argu->num_core > 1 && argu->async_io){
+        return INVALID;
+    }
+
+    /**
+     * Shortest remaining time first preempts a process when a process 
+     * arrives on a single CPU only, the cores do not stop at arrivals
+     */
+    if(argu->sched_algo == SR_A_FLAG 
+        && (argu->num_core > 1 || argu->speed_lst != NULL)){
+        return INVALID;
+    }
+
+    /**
+     * Buddy allocation splits the memory into power-of-two blocks, so the 
+     * memory (without the compressed pool) has at least one page
+     */
+    if(argu->mem_alloc == BU_M_FLAG){
+        long long int page_size = KB_PAGES;
+        if (argu->page_size != INVALID){
+            page_size = argu->page_size;
+        }
+        long long int mem_size = argu->mem_size;
+        if (argu->pool_size != INVALID){
+            mem_size -= argu->pool_size;
+        }
+        if (mem_size / page_size < 1){
+            return INVALID;
+        }
+    }
+
+    // A huge page is a power-of-two number of pages
+    if(argu->huge_size != INVALID){
+        long long int page_size = KB_PAGES;
+        if (argu->page_size != INVALID){
+            page_size = argu->page_size;
+        }
+        if (argu->huge_size % page_size != 0 
+            || argu->huge_size == page_size
+            || !is_power_two(argu->huge_size / page_size)){
+            return INVALID;
+        }
+    }
+
 
     return SUCCESS;
 }
@@ -129,6 +416,28 @@ ArguInfo *new_ArguInfo() {
     argu->mem_alloc = NULL_CHAR;
     argu->mem_size = INVALID;
     argu->quantum = DEFAULT_QUANTAM;
+    argu->placement = NULL_CHAR;
+    argu->oracle = 0;
+    argu->async_io = 0;
+    argu->prefetch_page = INITIAL;
+    argu->prefetch_proc = DEFAULT_PREFETCH_PROC;
+    argu->page_size = INVALID;
+    argu->huge_size = INVALID;
+    argu->pool_size = INVALID;
+    argu->compress_ratio = DEFAULT_COMPRESS_RATIO;
+    argu->seek_time = INVALID;
+    argu->swap_bandwidth = DEFAULT_SWAP_BANDWIDTH;
+    argu->cow_percent = DEFAULT_COW_PERCENT;
+    argu->num_core = DEFAULT_NUM_CORE;
+    argu->speed_lst = NULL;
+    argu->num_speed = INITIAL;
+    argu->core_place = ID_G_FLAG;
+    argu->level_quantam = NULL;
+    argu->num_level = INITIAL;
+    argu->boost_period = INVALID;
+    argu->target_latency = INVALID;
+    argu->ws_window = INVALID;
+    argu->fault_threshold = INVALID;
 
     return argu;
 }
@@ -144,6 +453,11 @@ void free_ArguInfo(ArguInfo *argu) {
     // Error if the ArguInfo does not initalise
     assert(argu!= NULL);
 
+    free(argu->speed_lst);
+    argu->speed_lst = NULL;
+    free(argu->level_quantam);
+    argu->level_quantam = NULL;
+
     // Free the ArguInfo data itself
     free(argu);
     argu = NULL;
@@ -159,7 +473,8 @@ void free_ArguInfo(ArguInfo *argu) {
  *          corresponding flags
  * 
  * @param   sched_algo  Scheduling algorithm choice from arguments
- * @return  char        If the memory allocation is one of {ff,rr,cs}, 
+ * @return  char        If the memory allocation is one of 
+ *                      {ff,rr,cs,srtf,mlfq,cfs}, 
  *                      return the corresponding flag
  *                      Otherwise, return NULL
  */
@@ -171,6 +486,12 @@ char valid_sched_algo(char *sched_algo){
         return RR_A_FLAG;
     } else if (strcmp(sched_algo, "cs") == SUCCESS) {
         return CS_A_FLAG;
+    } else if (strcmp(sched_algo, "srtf") == SUCCESS) {
+        return SR_A_FLAG;
+    } else if (strcmp(sched_algo, "mlfq") == SUCCESS) {
+        return ML_A_FLAG;
+    } else if (strcmp(sched_algo, "cfs") == SUCCESS) {
+        return CF_A_FLAG;
     } else {
         return NULL_CHAR;
     }
@@ -182,7 +503,8 @@ char valid_sched_algo(char *sched_algo){
  * @brief   Validate memory allocation choice and return the corresponding flags
  * 
  * @param   mem_alloc   Memory allocation choice from arguments
- * @return  char        If the memory allocation is one of {u,p,v,cm}, 
+ * @return  char        If the memory allocation is one of 
+ *                      {u,p,v,cm,b,clock,arc,lirs,ws}, 
  *                      return the corresponding flag
  *                      Otherwise, return NULL
  */
@@ -196,8 +518,113 @@ char valid_mem_alloc(char *mem_alloc){
         return VM_M_FLAG;
     } else if (strcmp(mem_alloc, "cm") == SUCCESS) {
         return CM_M_FLAG;
+    } else if (strcmp(mem_alloc, "b") == SUCCESS) {
+        return BU_M_FLAG;
+    } else if (strcmp(mem_alloc, "clock") == SUCCESS) {
+        return CL_M_FLAG;
+    } else if (strcmp(mem_alloc, "arc") == SUCCESS) {
+        return AR_M_FLAG;
+    } else if (strcmp(mem_alloc, "lirs") == SUCCESS) {
+        return LI_M_FLAG;
+    } else if (strcmp(mem_alloc, "ws") == SUCCESS) {
+        return WS_M_FLAG;
+    } else {
+        return NULL_CHAR;
+    }
+
+}
+
+
+/**
+ * @brief   Validate contiguous placement choice and return the 
+ *          corresponding flags
+ * 
+ * @param   placement   Contiguous placement choice from arguments
+ * @return  char        If the contiguous placement is one of {ff,bf,nf}, 
+ *                      return the corresponding flag
+ *                      Otherwise, return NULL
+ */
+char valid_placement(char *placement){
+    
+    if(strcmp(placement, "ff") == SUCCESS){
+        return FF_L_FLAG;
+    } else if (strcmp(placement, "bf") == SUCCESS) {
+        return BF_L_FLAG;
+    } else if (strcmp(placement, "nf") == SUCCESS) {
+        return NF_L_FLAG;
     } else {
         return NULL_CHAR;
     }
 
 }
+
+
+/**
+ * @brief   Validate core placement choice and return the corresponding flags
+ * 
+ * @param   core_place  Core placement choice from arguments
+ * @return  char        If the core placement is one of {idle,speed}, 
+ *                      return the corresponding flag
+ *                      Otherwise, return NULL
+ */
+char valid_core_place(char *core_place){
+    
+    if(strcmp(core_place, "idle") == SUCCESS){
+        return ID_G_FLAG;
+    } else if (strcmp(core_place, "speed") == SUCCESS) {
+        return SP_G_FLAG;
+    } else {
+        return NULL_CHAR;
+    }
+
+}
+
+
+/**
+ * @brief   Validate a comma-separated list of positive numbers, such as 
+ *          core speeds (percentages of the base speed) or the quantum of 
+ *          each level, and return it
+ * 
+ * @param   nums            List choice from arguments
+ * @param   num             Set to the number of numbers in the list
+ * @return  long long int*  If all numbers are valid, return a new list of
+ *                          them. Otherwise, return NULL
+ */
+long long int *valid_num_lst(char *nums, long long int *num){
+
+    long long int len = strlen(nums);
+    long long int *num_lst = (long long int *)malloc(
+                                    (len / 2 + 1) * sizeof(long long int));
+    if (num_lst == NULL) {
+        fprintf(stderr, "Error: valid_num_lst() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+
+    *num = 0;
+    char *start = nums;
+    while (1){
+        char *end = NULL;
+        long long int value = strtoll(start, &end, 10);
+        if (end == start || value <= 0 || (*end != ',' && *end != NULL_CHAR)){
+            free(num_lst);
+            return NULL;
+        }
+        num_lst[(*num)++] = value;
+        if (*end == NULL_CHAR){
+            break;
+        }
+        start = end + 1;
+    }
+    return num_lst;
+}
+
+
+/**
+ * @brief   Return if a number is a power of two
+ * 
+ * @param   num     a number
+ * @return  int     1 if it is a positive power of two, 0 otherwise
+ */
+int is_power_two(long long int num){
+    return num > 0 && (num & (num - 1)) == 0;
+}
@@ -6,7 +6,13 @@
  *              2. creating a new ArguInfo data
  *              3. destory and free a ArguInfo data
  *            The ArguInfo include filename, scheduling algorithm flags, and
- *            memory allocation flags, maximum memory size, quantum
+ *            memory allocation flags, maximum memory size, quantum,
+ *            contiguous placement flags, whether to compare with 
+ *            the oracle, the working-set window and page fault 
+ *            threshold percentage of the load control, whether pages
+ *            are loaded by the I/O device while other processes run, 
+ *            the number of pages and of processes to prefetch, and the page
+ *            size and huge page size
  *
  * @copyright created for COMP30023 Computer System 2020
  *
@@ -22,7 +28,21 @@
 typedef struct argu ArguInfo;
 /**
  * @brief   The ArguInfo include filename, scheduling algorithm flags, and
- *          memory allocation flags, maximum memory size, quantum
+ *          memory allocation flags, maximum memory size, quantum,
+ *          contiguous placement flags, whether to compare with 
+ *          the oracle, the working-set window and page fault 
+ *          threshold percentage of the load control, whether pages
+ *          are loaded by the I/O device while other processes run, 
+ *          the number of pages and of processes to prefetch, the page
+ *          size and huge page size, the compressed pool size and 
+ *          compression ratio, the seek time and bandwidth of the swap 
+ *          device, the percentage of shared pages written each run, 
+ *          the number of CPU cores, their speeds (percentages of the base 
+ *          speed, NULL if they all run at the base speed) and how 
+ *          processes are placed on them, and the quantum of each level 
+ *          (NULL unless the multi-level feedback queue is chosen), the 
+ *          number of levels and the period of priority boost, and the 
+ *          target latency of completely fair scheduling
  */
 struct argu {
     char *filename;
@@ -30,6 +50,28 @@ struct argu {
     char mem_alloc;
     long long int mem_size;
     long long int quantum;
+    char placement;
+    int oracle;
+    long long int ws_window;
+    long long int fault_threshold;
+    int async_io;
+    long long int prefetch_page;
+    long long int prefetch_proc;
+    long long int page_size;
+    long long int huge_size;
+    long long int pool_size;
+    long long int compress_ratio;
+    long long int seek_time;
+    long long int swap_bandwidth;
+    long long int cow_percent;
+    long long int num_core;
+    long long int *speed_lst;
+    long long int num_speed;
+    char core_place;
+    long long int *level_quantam;
+    long long int num_level;
+    long long int boost_period;
+    long long int target_latency;
 };
 
 
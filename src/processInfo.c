@@ -2,8 +2,10 @@
  * @file      processInfo.c
  * @author    Erya Wen (eryaw@student.unimelb.edu.au)
  * @brief     Implementation of Process related information module. It includes
- *              1. creating a new Process data 
- *              2. destory and free a Process data 
+ *              1. creating an arena that Process data are allocated from
+ *              2. creating a new Process data from an arena
+ *              3. destory and free an arena and all its Process data
+ *              4. creating the shared segment of each share group
  *
  * @copyright created for COMP30023 Computer System 2020
  *
@@ -19,23 +21,91 @@
 #include <string.h>
 
 
+// ============================================================================
+// == | Function Prototypes
+// ============================================================================
+// Compare the share group ids of two processes
+int share_id_comparator(const void *a, const void *b);
+
+
 // ============================================================================
 // == | Module Functions
 // ============================================================================
 /**
- * @brief  Create a new ProcessInfo data
+ * @brief  Create a new ProcessArena data which can hold a number of 
+ *         ProcessInfo data, which are allocated in one block
+ * 
+ * @param  capacity     the number of ProcessInfo data it can hold
+ * @return              return a pointer to the new ProcessArena data
+ */
+ProcessArena *new_ProcessArena(long long int capacity) {
+
+    ProcessArena *arena = (ProcessArena *)malloc(sizeof *arena);
+    if (arena == NULL) {
+        fprintf(stderr, "Error: new_ProcessArena() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Allocate at least one ProcessInfo data so the block is never empty
+    if (capacity < 1) {
+        capacity = 1;
+    }
+    arena->processes = (ProcessInfo *)malloc(capacity * sizeof(ProcessInfo));
+    if (arena->processes == NULL) {
+        fprintf(stderr, 
+            "Error: new_ProcessArena() malloc of processes returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Initalise value of the ProcessArena data
+    arena->capacity = capacity;
+    arena->size = INITIAL;
+    arena->num_share = INITIAL;
+
+    return arena;
+}
+
+
+/**
+ * @brief  Destroy and free the memory associated with a ProcessArena data,
+ *         all ProcessInfo data created from it are freed at once
+ * 
+ * @param  arena   a ProcessArena data
+ */
+void free_ProcessArena(ProcessArena *arena) {
+
+    // Error if the ProcessArena does not initalise
+    assert(arena != NULL);
+
+    // Free all ProcessInfo data in one block
+    free(arena->processes);
+    arena->processes = NULL;
+
+    // Free the ProcessArena data itself
+    free(arena);
+    arena = NULL;
+}
+
+
+/**
+ * @brief  Create a new ProcessInfo data from a ProcessArena
  * 
- * @return      return a pointer to the new ProcessInfo data
+ * @param  arena    a ProcessArena data
+ * @return          return a pointer to the new ProcessInfo data
  */
-ProcessInfo *new_ProcessInfo() {
+ProcessInfo *new_ProcessInfo(ProcessArena *arena) {
 
-    ProcessInfo *p = (ProcessInfo *)malloc(sizeof *p);
-    if (p == NULL) {
-        fprintf(stderr, "Error: new_ProcessInfo() malloc returned NULL\n");
+    // Error if the ProcessArena does not initalise or it is full
+    assert(arena != NULL);
+    if (arena->size == arena->capacity) {
+        fprintf(stderr, "Error: new_ProcessInfo() ProcessArena is full\n");
         exit(EXIT_FAILURE);
     }
 
-    // Initalise value of the CPUInfo data
+    ProcessInfo *p = &arena->processes[arena->size];
+    arena->size++;
+
+    // Initalise value of the ProcessInfo data
     p->arrive_time = INVALID;
     p->p_id = INVALID;
     p->mem_size_req = INVALID;
@@ -50,26 +120,122 @@ ProcessInfo *new_ProcessInfo() {
 
     p->mem_usage = INITIAL;
     
-    p->page_list = NULL;
+    init_PageList(&p->page_list);
 	p->remaining_time = INITIAL;
-    
+
+    p->index_pos = INVALID;
+
+    for (int i = 0; i < NUM_REPL_SLOT; i++){
+        p->repl_node[i].prev = NULL;
+        p->repl_node[i].next = NULL;
+        p->repl_node[i].list = NULL;
+        p->repl_node[i].num_page = INITIAL;
+    }
+    p->repl_status = NULL_CHAR;
+    p->next_use = INVALID;
+    p->last_fault_time = INVALID;
+    p->io_done_time = INVALID;
+    p->num_prefetch = INITIAL;
+    p->page_ratio = 1;
+    p->swap_page = INITIAL;
+    p->swap_extent = INITIAL;
+    p->num_clean_page = INITIAL;
+    p->share_id = INVALID;
+    p->share = NULL;
+    p->num_share_page = INVALID;
+    p->cow_write = INITIAL;
+    p->share_ref = INITIAL;
+    p->num_share_member = INITIAL;
+    p->core_id = INVALID;
+    p->level = INITIAL;
+    p->next_wait = NULL;
+    p->nice = INITIAL;
+    p->vruntime = INITIAL;
 
     return p;
 }
 
 
 /**
- * @brief  Destroy and free the memory associated with a ProcessInfo data
+ * @brief  Create the shared segment of each share group of the processes 
+ *         in an arena, a group has at least two processes. The segment is
+ *         a ProcessInfo data from the arena, it is as large as the smallest 
+ *         process of the group (the memory common to all of them)
  * 
- * @param  resp   a ProcessInfo data
+ * @param  arena    a ProcessArena data
  */
-void free_ProcessInfo(ProcessInfo *p) {
+void share_ProcessArena(ProcessArena *arena) {
+
+    // Sort the processes with a share group id by the id
+    long long int num_process = arena->size;
+    ProcessInfo **share_lst = (ProcessInfo **)malloc(
+                            (num_process + 1) * sizeof(ProcessInfo *));
+    if (share_lst == NULL) {
+        fprintf(stderr, "Error: share_ProcessArena() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+    long long int num_share = 0;
+    for (long long int i = 0; i < num_process; i++){
+        if (arena->processes[i].share_id != INVALID){
+            share_lst[num_share] = &arena->processes[i];
+            num_share++;
+        }
+    }
+    qsort(share_lst, num_share, sizeof(ProcessInfo *), share_id_comparator);
+
+    // Create a segment for each run of processes of the same id
+    long long int start = 0;
+    while (start < num_share){
+        long long int end = start + 1;
+        long long int min_size = share_lst[start]->mem_size_req;
+        while (end < num_share 
+                && share_lst[end]->share_id == share_lst[start]->share_id){
+            if (share_lst[end]->mem_size_req < min_size){
+                min_size = share_lst[end]->mem_size_req;
+            }
+            end++;
+        }
 
-    // Error if the ProcessInfo does not initalise
-    assert(p!= NULL);
+        if (end - start > 1){
+            ProcessInfo *share = new_ProcessInfo(arena);
+            share->share_id = share_lst[start]->share_id;
+            share->mem_size_req = min_size;
+            share->job_time = 0;
+            share->num_share_member = end - start;
+            for (long long int i = start; i < end; i++){
+                share_lst[i]->share = share;
+            }
+            arena->num_share++;
+        }
+        start = end;
+    }
 
-    // Free the ProcessInfo data itself
-    free(p);
-    p = NULL;
+    free(share_lst);
+    share_lst = NULL;
 }
 
+
+// ============================================================================
+// == | Auxillary Functions 
+// ============================================================================
+/**
+ * @brief  Compare the share group ids of two processes, and their arena 
+ *         positions if the ids are equal
+ * 
+ * @param  a        a pointer to a ProcessInfo pointer
+ * @param  b        a pointer to a ProcessInfo pointer
+ * @return int      0 if they are equal
+ *                  1 if a > b
+ *                  -1 if a < b
+ */
+int share_id_comparator(const void *a, const void *b){
+    ProcessInfo *p_a = *(ProcessInfo **)a;
+    ProcessInfo *p_b = *(ProcessInfo **)b;
+    if (p_a->share_id != p_b->share_id){
+        return p_a->share_id > p_b->share_id ? 1 : -1;
+    }
+    if (p_a != p_b){
+        return p_a > p_b ? 1 : -1;
+    }
+    return 0;
+}
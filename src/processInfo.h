@@ -2,8 +2,10 @@
  * @file      ProcessInfo.h
  * @author    Erya Wen (eryaw@student.unimelb.edu.au)
  * @brief     Process related information module. It includes
- *              1. creating a new Process data
- *              2. destory and free a Process data
+ *              1. creating an arena that Process data are allocated from
+ *              2. creating a new Process data from an arena
+ *              3. destory and free an arena and all its Process data
+ *              4. creating the shared segment of each share group
  *
  * @copyright created for COMP30023 Computer System 2020
  *
@@ -12,6 +14,9 @@
 #ifndef PROCESSINFO_H
 #define PROCESSINFO_H
 
+#include "pageList.h"
+#include "replList.h"
+
 
 // ============================================================================
 // == | Data Type Definitions
@@ -23,7 +28,27 @@ typedef struct process ProcessInfo;
  *        time be completed, 
  *        and time required to load to execute it, page fault, and
  *        a page list currently occupied by this process and the number of them,
- *        memory used by this process.
+ *        memory used by this process, and its heap index in an indexed queue,
+ *        and its links in the replacement lists and replacement status
+ *        for adaptive page replacement, when it runs next for 
+ *        Belady optimal page replacement, when it had page faults last 
+ *        time for page-fault-frequency, when its pages finish loading 
+ *        if they are being loaded by the I/O device, the number of its
+ *        pages prefetched before it runs, the number of pages in each 
+ *        of its pages (more than 1 for huge pages), and its number of pages 
+ *        and extents on the swap device and of pages in memory which are 
+ *        clean (loaded but not run yet).
+ *        For copy-on-write sharing, it includes its share group id, the 
+ *        shared segment of its group, the number of its pages still 
+ *        shared in it and the part of a page written (in percent) not 
+ *        copied yet. A shared segment records the number of processes 
+ *        using its pages (the reference count of its pages) and the number 
+ *        of processes of the group not finished.
+ *        For multi-core simulation, it includes the core it is running on.
+ *        For multi-level feedback queue scheduling, it includes its level 
+ *        and the next process waiting in the same level.
+ *        For completely fair scheduling, it includes its nice value and 
+ *        its virtual runtime.
  */
 struct process{
     long long int arrive_time;
@@ -41,16 +66,65 @@ struct process{
     long long int load_time;
     
     long long int mem_usage;
-    long long int *page_list;
+    PageList page_list;
+
+    long long int index_pos;
+
+    ReplNode repl_node[NUM_REPL_SLOT];
+    char repl_status;
+
+    long long int next_use;
+    long long int last_fault_time;
+    long long int io_done_time;
+    long long int num_prefetch;
+    long long int page_ratio;
+    long long int swap_page;
+    long long int swap_extent;
+    long long int num_clean_page;
+
+    long long int share_id;
+    ProcessInfo *share;
+    long long int num_share_page;
+    long long int cow_write;
+    long long int share_ref;
+    long long int num_share_member;
+
+    long long int core_id;
+
+    long long int level;
+    ProcessInfo *next_wait;
+
+    long long int nice;
+    long long int vruntime;
+};
+
+typedef struct process_arena ProcessArena;
+/**
+ * @brief The ProcessArena is a block of ProcessInfo data allocated at once,
+ *        it records the number of ProcessInfo data it can hold and
+ *        the number of them currently be used, and the number of share 
+ *        groups.
+ */
+struct process_arena{
+    ProcessInfo *processes;
+    long long int capacity;
+    long long int size;
+    long long int num_share;
 };
 
 // ============================================================================
 // == | Module Functions
 // ============================================================================
-//  Create a new ProcessInfo data
-ProcessInfo *new_ProcessInfo();
+// Create a new ProcessArena data which can hold a number of ProcessInfo data
+ProcessArena *new_ProcessArena(long long int capacity);
+
+// Destroy and free the memory associated with a ProcessArena data
+void free_ProcessArena(ProcessArena *arena);
+
+//  Create a new ProcessInfo data from a ProcessArena
+ProcessInfo *new_ProcessInfo(ProcessArena *arena);
 
-// Destroy and free the memory associated with a ProcessInfo data
-void free_ProcessInfo(ProcessInfo *process);
+// Create the shared segment of each share group of processes in an arena
+void share_ProcessArena(ProcessArena *arena);
 
 #endif
@@ -2,12 +2,16 @@
  * @file      queue.c
  * @author    Erya Wen (eryaw@student.unimelb.edu.au)
  * @brief     Implementation of Queue module. It includes
- *              1. creating new queue
+ *              1. creating new queue (a binary heap priority queue)
  *              2. destory a queue
  *              3. inserting elements to the queue
  *              4. deleting elements from the start of the queue
  *              5. getting size of the queue
  *              6. getting specific position elements in the queue
+ *              7. copying a queue into a new queue with another priority
+ *              8. removing a given element from an indexed queue
+ *              9. getting the first elements in priority order
+ *             10. moving all processes of a level queue to the top level
  *
  * @copyright created for COMP30023 Computer System 2020
  *
@@ -16,19 +20,20 @@
 #include "queue.h"
 
 #include "processInfo.h"
+#include "utilities.h"
 
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <string.h>
+
+
 
 
 // ============================================================================
 // == | Constant Definitions 
 // ============================================================================
-#define INSERT_LAST         -1
-#define INSERT_MIDDLE       1
-#define INSERT_START        0
+#define INITIAL_CAPACITY    16
+#define ROOT                0
 
 
 // ============================================================================
@@ -36,35 +41,90 @@
 // ============================================================================
 typedef struct node Node;
 /**
- * @brief  A queue node points to the next and previous node in the queue,
- *         which data is ProcessInfo datatype
+ * @brief  A queue node stores a ProcessInfo data and the priority value 
+ *         it was given when it was enqueued
  */
 struct node {
-    struct node *prev;
-    struct node *next;
+    long long int priority;
     ProcessInfo *process;
 };
 
 
 /**
- * @brief  A queue points to its first and last nodes,
- *         and stores its size (number of nodes)
+ * @brief  A queue is a binary min-heap of nodes, ordered by priority value
+ *         and then process id. It stores its size (number of nodes), 
+ *         the capacity of the heap array, the number of enqueue made
+ *         and the function getting priority value chosen when it was created.
+ *         An indexed queue also records the heap index of each process 
+ *         in the process itself, so any process can be removed from it.
+ *         A level queue does not use the heap, it records the first and 
+ *         last process of a list for each level, linked through the 
+ *         processes, so adding and removing a process take O(1) time
  */
 struct queue {
-    Node *head;
-    Node *last;
+    Node *heap;
     long long int size;
+    long long int capacity;
+    long long int num_enqueue;
+    int is_indexed;
+    long long int (*get_priority)(Queue *queue, ProcessInfo *p);
+
+    int is_level;
+    ProcessInfo *level_head[MAX_NUM_LEVEL];
+    ProcessInfo *level_tail[MAX_NUM_LEVEL];
 };
 
 
 // ============================================================================
 // == | Function Prototypes
 // ============================================================================
-// Create a new node and return its address
-Node *new_node(ProcessInfo *process);
+// Get the priority value which is process arrival time
+long long int prio_arrival_time(Queue *queue, ProcessInfo *p);
+
+// Get the priority value which is process last execution time
+long long int prio_last_exe_time(Queue *queue, ProcessInfo *p);
+
+// Get the priority value which is process job time
+long long int prio_job_time(Queue *queue, ProcessInfo *p);
+
+// Get the priority value which is process pages in memory
+long long int prio_min_page(Queue *queue, ProcessInfo *p);
+
+// Get the priority value which is process completion time
+long long int prio_complete_time(Queue *queue, ProcessInfo *p);
+
+// Get the priority value which is the order the process added to the queue
+long long int prio_enqueue_time(Queue *queue, ProcessInfo *p);
+
+// Get the priority value which is the negative of when process runs next
+long long int prio_next_use(Queue *queue, ProcessInfo *p);
+
+// Get the priority value which is when the process finishes loading pages
+long long int prio_io_done_time(Queue *queue, ProcessInfo *p);
+
+// Get the priority value which is process remaining time
+long long int prio_remaining_time(Queue *queue, ProcessInfo *p);
+
+// Get the priority value which is process level
+long long int prio_level(Queue *queue, ProcessInfo *p);
+
+// Get the priority value which is process virtual runtime
+long long int prio_vruntime(Queue *queue, ProcessInfo *p);
 
-// Get the priority value based on the priority choice
-long long int get_priority(ProcessInfo *p, char *prio_flag);
+// Return the first level with a process in a level queue
+long long int get_top_level(Queue *queue);
+
+// Place a node at a heap index
+void place_node(Queue *queue, long long int index, Node node);
+
+// Check if node a should be dequeued before node b
+int is_before(Node *a, Node *b);
+
+// Move a node up the heap until its parent is before it
+void sift_up(Queue *queue, long long int index);
+
+// Move a node down the heap until it is before both its children
+void sift_down(Queue *queue, long long int index);
 
 
 // ============================================================================
@@ -73,9 +133,10 @@ long long int get_priority(ProcessInfo *p, char *prio_flag);
 /**
  * @brief  Create a new empty Queue 
  * 
+ * @param  prio   a priority the Queue is ordered by
  * @return        the pointer of new empty Queue
  */
-Queue *new_queue() {
+Queue *new_queue(QueuePrio prio) {
 
     Queue *queue = (Queue *)malloc(sizeof *queue);
     if (queue == NULL) {
@@ -84,16 +145,84 @@ Queue *new_queue() {
     }
 
     // Initalise value of the queue
-    queue->head = NULL;
-    queue->last = NULL;
+    queue->heap = (Node *)malloc(INITIAL_CAPACITY * sizeof(Node));
+    if (queue->heap == NULL) {
+        fprintf(stderr, "Error: new_queue() malloc of heap returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
     queue->size = 0;
+    queue->capacity = INITIAL_CAPACITY;
+    queue->num_enqueue = 0;
+    queue->is_indexed = 0;
+    queue->is_level = 0;
+    for (int i = 0; i < MAX_NUM_LEVEL; i++){
+        queue->level_head[i] = NULL;
+        queue->level_tail[i] = NULL;
+    }
+
+    // Choose how to get the priority value once, based on the priority
+    switch (prio){
+        case PRIO_ARRIVAL_T:
+            queue->get_priority = prio_arrival_time;
+            break;
+        case PRIO_LAST_EXE_T:
+            queue->get_priority = prio_last_exe_time;
+            break;
+        case PRIO_JOB_T:
+            queue->get_priority = prio_job_time;
+            break;
+        case PRIO_MIN_PAGE:
+            queue->get_priority = prio_min_page;
+            break;
+        case PRIO_COMPLETE_T:
+            queue->get_priority = prio_complete_time;
+            break;
+        case PRIO_ENQUEUE_T:
+            queue->get_priority = prio_enqueue_time;
+            break;
+        case PRIO_NEXT_USE:
+            queue->get_priority = prio_next_use;
+            break;
+        case PRIO_IO_DONE_T:
+            queue->get_priority = prio_io_done_time;
+            break;
+        case PRIO_REMAIN_T:
+            queue->get_priority = prio_remaining_time;
+            break;
+        case PRIO_LEVEL:
+            queue->get_priority = prio_level;
+            queue->is_level = 1;
+            break;
+        case PRIO_VRUNTIME:
+            queue->get_priority = prio_vruntime;
+            break;
+        default:
+            fprintf(stderr, "Invalid priority flag");
+            exit(EXIT_FAILURE);
+    }
+
+    return queue;
+}
 
+
+/**
+ * @brief  Create a new empty indexed Queue, which records the heap index of 
+ *         each process, so any process can be removed from it.
+ *         A process can only be in one indexed Queue at a time
+ * 
+ * @param  prio   a priority the Queue is ordered by
+ * @return        the pointer of new empty indexed Queue
+ */
+Queue *new_indexed_queue(QueuePrio prio) {
+    Queue *queue = new_queue(prio);
+    queue->is_indexed = 1;
     return queue;
 }
 
 
 /**
- * @brief  Destroy and free the memory associated with a Queue
+ * @brief  Destroy and free the memory associated with a Queue. 
+ *         The ProcessInfo data are owned by their ProcessArena, not freed here
  *
  * @param  queue  a Queue
  */
@@ -102,18 +231,9 @@ void free_queue(Queue *queue) {
     // Error if the list does not initalise
     assert(queue != NULL);
 
-    // Free ProcessInfo data in each nodes.
-    long long int size = get_queue_size(queue);
-    while (size > 0) {
-        ProcessInfo *process = dequeue(queue);
-        free_ProcessInfo(process);
-        size = get_queue_size(queue);
-    }
-
-    // Free the last node and queue itself
-    free(queue->last);
-    queue->head = NULL;
-    queue->last = NULL;
+    // Free the heap and queue itself
+    free(queue->heap);
+    queue->heap = NULL;
 
     free(queue);
     queue = NULL;
@@ -126,83 +246,59 @@ void free_queue(Queue *queue) {
  * 
  * @param  queue      a Queue
  * @param  process    a ProcessInfo data
- * @param  prio_flag  a Priority flag
  */
-void enqueue(Queue *queue, ProcessInfo *process, char *prio_flag) {
+void enqueue(Queue *queue, ProcessInfo *process) {
 
     // Error if the list or process does not initalise
     assert(queue != NULL);
     assert(process != NULL);
 
-    // Creat a new queue node to store this data
-    Node *node = new_node(process);
-
-    // Connect the node with the current last node
-    node->prev = queue->last;
-  
-
-    if (queue->size == 0) {
-        // If the queue was empty, new node is now the first node
-        queue->head = node;
-        queue->last = node;
-    } else {
-         // Otherwise, it goes after the current last node
-        Node *last = queue->last;
-
-        int insert_flag = INSERT_LAST;
-        
-        /**
-         * Enqueue the process based on the priority value in ascending order
-         * If the 2 processes priority value are the same, 
-         * based on the process id in ascening oreder
-         */
-        while (get_priority(last->process, prio_flag) 
-                > get_priority(node->process, prio_flag)
-            || (get_priority(last->process, prio_flag) 
-                == get_priority(node->process, prio_flag)
-            && last->process->p_id > node->process->p_id)){
-
-            if (last -> prev == NULL){
-                insert_flag = INSERT_START;
-                node->next = last;
-                last->prev = node;
-                queue->head = node;
-                break;
-            } 
-            insert_flag = INSERT_MIDDLE;
-            last = last->prev;
+    // Add the process to the end of the list of its level
+    if (queue->is_level) {
+        long long int level = process->level;
+        assert(level >= 0 && level < MAX_NUM_LEVEL);
+        process->next_wait = NULL;
+        if (queue->level_tail[level] == NULL) {
+            queue->level_head[level] = process;
+        } else {
+            queue->level_tail[level]->next_wait = process;
         }
-    
-
-        if (insert_flag == INSERT_START){
-            // Place this new node at the start of the queue
-            node->next = last;
-            last->prev = node;
-            queue->head = node;
-            node->prev = NULL;
-
-        } else if (insert_flag == INSERT_MIDDLE){
-            // Place this new node at the middle of the queue
-            node->next = last->next;
-            node->prev = last;
-            last->next->prev = node;
-            last->next = node;
-
-        } else{
-            // Place this new node at the end of the queue
-            last->next = node;
-            queue->last = node;
+        queue->level_tail[level] = process;
+        queue->size++;
+        queue->num_enqueue++;
+        return;
+    }
+
+    // Double the heap array if it is full
+    if (queue->size == queue->capacity) {
+        queue->capacity *= 2;
+        queue->heap = (Node *)realloc(queue->heap, 
+                                    queue->capacity * sizeof(Node));
+        if (queue->heap == NULL) {
+            fprintf(stderr, "Error: enqueue() realloc of heap returned NULL\n");
+            exit(EXIT_FAILURE);
         }
     }
 
-    // Update the queue size
+    /**
+     * Place the process at the end of the heap and move it up, so the queue
+     * is kept in ascending order of priority value, and in ascending order
+     * of process id if the 2 processes priority value are the same
+     */
+    Node node;
+    node.priority = queue->get_priority(queue, process);
+    node.process = process;
+    place_node(queue, queue->size, node);
+    sift_up(queue, queue->size);
+
+    // Update the queue size and number of enqueue made
     queue->size++;
+    queue->num_enqueue++;
 }
 
 
 /**
- * @brief  Remove and return the first ProcessInfo data from a Queue, 
- *         and free the memory of the node
+ * @brief  Remove and return the first ProcessInfo data from a Queue
  * 
  * @param  queue  a Queue
  * @return        the first ProcessInfo data from a Queue
@@ -213,31 +309,75 @@ ProcessInfo *dequeue(Queue *queue) {
     assert(queue != NULL);
     assert(queue->size > 0);
 
-    // Set a ProcessInfo to save the data will be removed
-    ProcessInfo *process = queue->head->process;
-
-    if (queue->size == 1) {
-        // If it was the last node in the queue, the last needs to be cleared
-        // and free the memory
-        free(queue->head);
-        queue->last = NULL;
-    } else {
-        // Otherwise, the next node becomes the first node
-        queue->head = queue->head->next;
-
-        // free the memory
-        free(queue->head->prev);
-        queue->head->prev = NULL;
+    /**
+     * Remove the first process of the first level with a process, its 
+     * level is the level it is removed from, which is the top level if 
+     * the queue was boosted
+     */
+    if (queue->is_level) {
+        long long int level = get_top_level(queue);
+        ProcessInfo *process = queue->level_head[level];
+        queue->level_head[level] = process->next_wait;
+        if (queue->level_head[level] == NULL) {
+            queue->level_tail[level] = NULL;
+        }
+        process->next_wait = NULL;
+        process->level = level;
+        queue->size--;
+        return process;
     }
 
-    // Update the queue size
+    // Set a ProcessInfo to save the data will be removed
+    ProcessInfo *process = queue->heap[ROOT].process;
+
+    // Move the last node to the root and move it down to its place
     queue->size--;
+    if (queue->size > 0) {
+        place_node(queue, ROOT, queue->heap[queue->size]);
+        sift_down(queue, ROOT);
+    }
+    if (queue->is_indexed) {
+        process->index_pos = INVALID;
+    }
 
     // Return the first ProcessInfo data from the queue
     return process;
 }
 
 
+/**
+ * @brief  Remove a ProcessInfo data from an indexed Queue, 
+ *         if it is in the Queue
+ * 
+ * @param  queue    an indexed Queue
+ * @param  process  a ProcessInfo data
+ */
+void remove_queue_point(Queue *queue, ProcessInfo *process) {
+
+    // Error if the list does not initalise or it is not indexed
+    assert(queue != NULL);
+    assert(queue->is_indexed);
+
+    long long int index = process->index_pos;
+    if (index == INVALID) {
+        return;
+    }
+    assert(queue->heap[index].process == process);
+
+    /**
+     * Move the last node to the place of the removed node, and move it up 
+     * or down to its place
+     */
+    queue->size--;
+    if (index != queue->size) {
+        place_node(queue, index, queue->heap[queue->size]);
+        sift_up(queue, index);
+        sift_down(queue, index);
+    }
+    process->index_pos = INVALID;
+}
+
+
 /**
  * @brief  Get the number of elements in a Queue
  * 
@@ -255,108 +395,439 @@ long long int get_queue_size(Queue *queue) {
 
 
 /**
- * @brief  Get the data of a given index ProcessInfo from a Queue
+ * @brief  Get the data of a given index ProcessInfo from a Queue.
+ *         Index 0 is always the first ProcessInfo data of the Queue, 
+ *         other indexes follow the heap order instead of the priority order.
+ *         The indexes of a level queue follow the priority order, getting
+ *         one takes O(index) time
  * 
  * @param  queue  a Queue
  * @param  index  an index
  * @return        the ProcessInfo data of a given index from a Queue
  */
 ProcessInfo *get_queue_point(Queue *queue, long long int index) {
-    long long int start;
-    long long int i;
-    Node *curr;
 
     // Error if the list does not initalise or it is empty, or index is invalid
     assert(queue != NULL);
     assert(queue->size > index);
     assert(index >= 0);
 
-    if (index >= (queue->size / 2)) {
-        // If the index is near the end, find the node from the end of the queue
-        start = queue->size - 1;
-        curr  = queue->last;
+    // Walk the lists of a level queue from the top level
+    if (queue->is_level) {
+        long long int level = get_top_level(queue);
+        ProcessInfo *process = queue->level_head[level];
+        for (; index > 0; index--) {
+            process = process->next_wait;
+            while (process == NULL) {
+                level++;
+                process = queue->level_head[level];
+            }
+        }
+        return process;
+    }
+
+    // Return the ProcessInfo data of a given index from a Queue
+    return queue->heap[index].process;
+}
+
+
+/**
+ * @brief  Get the first number of ProcessInfo data of a Queue in priority
+ *         order without removing them. The next one is always the root or 
+ *         a child of one got already, so only these candidates are 
+ *         compared, which takes O(k^2) time for k elements. The lists 
+ *         of a level queue are walked in O(k) time
+ * 
+ * @param  queue  a Queue
+ * @param  list   a list to record the ProcessInfo data, at least num long
+ * @param  num    number of ProcessInfo data to get
+ * @return        number of ProcessInfo data got, at most the queue size
+ */
+long long int peek_queue(Queue *queue, ProcessInfo **list, long long int num) {
+
+    // Error if the list does not initalise
+    assert(queue != NULL);
+
+    if (num > queue->size) {
+        num = queue->size;
+    }
+    if (num <= 0) {
+        return 0;
+    }
+
+    // The lists of a level queue are in priority order already
+    if (queue->is_level) {
+        long long int level = get_top_level(queue);
+        ProcessInfo *process = queue->level_head[level];
+        for (long long int i = 0; i < num; i++) {
+            while (process == NULL) {
+                level++;
+                process = queue->level_head[level];
+            }
+            list[i] = process;
+            process = process->next_wait;
+        }
+        return num;
+    }
+
+    // Each one got removes a candidate and adds at most two children
+    long long int *cand = (long long int *)malloc((num + 1) * sizeof(long long int));
+    if (cand == NULL) {
+        fprintf(stderr, "Error: peek_queue() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+    long long int num_cand = 1;
+    cand[0] = ROOT;
+
+    for (long long int i = 0; i < num; i++) {
+        long long int best = 0;
+        for (long long int j = 1; j < num_cand; j++) {
+            if (is_before(&queue->heap[cand[j]], &queue->heap[cand[best]])) {
+                best = j;
+            }
+        }
 
-        for (i = start; i > index; i--) {
-            curr = curr->prev;
+        long long int index = cand[best];
+        list[i] = queue->heap[index].process;
+        num_cand--;
+        cand[best] = cand[num_cand];
+
+        for (long long int child = 2 * index + 1; 
+                child <= 2 * index + 2 && child < queue->size 
+                && num_cand <= num; child++) {
+            cand[num_cand] = child;
+            num_cand++;
         }
-    } else {
-        // Otherwise, find the node from the start of the queue
-        start = 0;
-        curr  = queue->head;
+    }
+
+    free(cand);
+    return num;
+}
+
+
+/**
+ * @brief  Create a new Queue ordered by a priority with all elements of 
+ *         a Queue. The heap is built bottom-up, which takes O(n) time 
+ *         instead of O(n log n) time for n enqueue
+ * 
+ * @param  queue  a Queue
+ * @param  prio   a priority the new Queue is ordered by
+ * @return        the pointer of new Queue
+ */
+Queue *copy_queue(Queue *queue, QueuePrio prio) {
 
-        for (i = start; i < index; i++) {
-            curr = curr->next;
+    // Error if the list does not initalise, a level queue is not copied
+    assert(queue != NULL);
+    assert(!queue->is_level && prio != PRIO_LEVEL);
+
+    Queue *copy = new_queue(prio);
+
+    // Make the heap array large enough to hold all elements
+    if (queue->size > copy->capacity) {
+        copy->capacity = queue->size;
+        copy->heap = (Node *)realloc(copy->heap, copy->capacity * sizeof(Node));
+        if (copy->heap == NULL) {
+            fprintf(stderr, 
+                "Error: copy_queue() realloc of heap returned NULL\n");
+            exit(EXIT_FAILURE);
         }
     }
 
-    // Return the ProcessInfo data of a given index from a Queue
-    return curr->process;
+    // Copy all elements with their priority value of the new Queue
+    for (long long int i = 0; i < queue->size; i++) {
+        Node *node = &copy->heap[i];
+        node->process = queue->heap[i].process;
+        node->priority = copy->get_priority(copy, node->process);
+        copy->size++;
+        copy->num_enqueue++;
+    }
+
+    // Move every parent node down to its place, from the last parent node
+    for (long long int i = copy->size / 2 - 1; i >= ROOT; i--) {
+        sift_down(copy, i);
+    }
+
+    return copy;
+}
+
+/**
+ * @brief  Move all ProcessInfo data of a Queue to the top level. The lists 
+ *         of a level queue are joined in level order in O(number of levels)
+ *         time, the level of each process is updated when it is removed. 
+ *         The level of each process in another Queue is updated now
+ * 
+ * @param  queue  a Queue
+ */
+void boost_queue(Queue *queue) {
+
+    // Error if the list does not initalise
+    assert(queue != NULL);
+
+    if (!queue->is_level) {
+        for (long long int i = 0; i < queue->size; i++) {
+            queue->heap[i].process->level = 0;
+        }
+        return;
+    }
+
+    for (long long int level = 1; level < MAX_NUM_LEVEL; level++) {
+        if (queue->level_head[level] == NULL) {
+            continue;
+        }
+        if (queue->level_tail[0] == NULL) {
+            queue->level_head[0] = queue->level_head[level];
+        } else {
+            queue->level_tail[0]->next_wait = queue->level_head[level];
+        }
+        queue->level_tail[0] = queue->level_tail[level];
+        queue->level_head[level] = NULL;
+        queue->level_tail[level] = NULL;
+    }
 }
 
 // ============================================================================
 // == | Auxillary Functions 
 // ============================================================================
 /**
- * @brief  Create a new node and return its address
+ * @brief  Get the priority value which is process arrival time
  * 
- * @param  process    a ProcessInfo data
- * @return        the address of a new node, with process as data
+ * @param  queue            a Queue the process will be added to
+ * @param  p                a process
+ * @return long long int    a priority value
  */
-Node *new_node(ProcessInfo *process) {
-    
-    Node *node = (Node *)malloc(sizeof(*node));
-    if (node == NULL) {
-        fprintf(stderr, "Error: new_node() malloc returned NULL\n");
-        exit(EXIT_FAILURE);
-    }
+long long int prio_arrival_time(Queue *queue, ProcessInfo *p){
+    (void)queue;
+    return p->arrive_time;
+}
+
+
+/**
+ * @brief  Get the priority value which is process last execution time
+ * 
+ * @param  queue            a Queue the process will be added to
+ * @param  p                a process
+ * @return long long int    a priority value
+ */
+long long int prio_last_exe_time(Queue *queue, ProcessInfo *p){
+    (void)queue;
+    return p->last_execution_time;
+}
+
+
+/**
+ * @brief  Get the priority value which is process job time
+ * 
+ * @param  queue            a Queue the process will be added to
+ * @param  p                a process
+ * @return long long int    a priority value
+ */
+long long int prio_job_time(Queue *queue, ProcessInfo *p){
+    (void)queue;
+    return p->job_time;
+}
 
 
-    // Assign the data value
-    // Initialise the previous and next node as NULL
-    node->process  = process;
-    node->prev = NULL;
-    node->next = NULL;
+/**
+ * @brief  Get the priority value which is process pages in memory, 
+ *         so the process with the fewest pages is dequeued first
+ * 
+ * @param  queue            a Queue the process will be added to
+ * @param  p                a process
+ * @return long long int    a priority value
+ */
+long long int prio_min_page(Queue *queue, ProcessInfo *p){
+    (void)queue;
+    return p->num_page_in_mem;
+}
+
 
-    // Return the new node address
-    return node;
+/**
+ * @brief  Get the priority value which is process completion time
+ * 
+ * @param  queue            a Queue the process will be added to
+ * @param  p                a process
+ * @return long long int    a priority value
+ */
+long long int prio_complete_time(Queue *queue, ProcessInfo *p){
+    (void)queue;
+    return p->complete_time;
 }
 
 
 /**
- * @brief  Get the priority value based on priority flag
+ * @brief  Get the priority value which is the order the process 
+ *         added to the queue
  * 
- * @param  p            a process
- * @param  prio_flag    a priority flag
- * @return long long int     a priority value
+ * @param  queue            a Queue the process will be added to
+ * @param  p                a process
+ * @return long long int    a priority value
  */
-long long int get_priority(ProcessInfo *p, char *prio_flag){
+long long int prio_enqueue_time(Queue *queue, ProcessInfo *p){
+    (void)p;
+    return queue->num_enqueue;
+}
 
-    if (strcmp(prio_flag, PRIO_ARRIVAL_T) == 0){
-        // Priority value is process arrival time
-        return p->arrive_time;
 
-    } else if (strcmp(prio_flag, PRIO_JOB_T) == 0){
-        // Priority value is process job time
-        return p->job_time;
+/**
+ * @brief  Get the priority value which is the negative of when the process
+ *         runs next, so the process runs furthest in the future is first
+ * 
+ * @param  queue            a Queue the process will be added to
+ * @param  p                a process
+ * @return long long int    a priority value
+ */
+long long int prio_next_use(Queue *queue, ProcessInfo *p){
+    (void)queue;
+    assert(p->next_use != INVALID);
+    return -p->next_use;
+}
 
-    } else if (strcmp(prio_flag, PRIO_LAST_EXE_T) == 0){
-        // Priority value is process last execution time
-        return p->last_execution_time;
 
-    } else if (strcmp(prio_flag, PRIO_MAX_PAGE) == 0){
-        // Priority value is process pages in memory
-        return p->num_page_in_mem;
+/**
+ * @brief  Get the priority value which is when the process finishes 
+ *         loading its pages by the I/O device
+ * 
+ * @param  queue            a Queue the process will be added to
+ * @param  p                a process
+ * @return long long int    a priority value
+ */
+long long int prio_io_done_time(Queue *queue, ProcessInfo *p){
+    (void)queue;
+    return p->io_done_time;
+}
 
-    } else if (strcmp(prio_flag, PRIO_COMPLETE_T) == 0){
-        // Priority value is process completion time
-        return p->complete_time;
 
-    } else {
-        fprintf(stderr, "Invalid priority flag");
-        exit(EXIT_FAILURE);
+/**
+ * @brief  Get the priority value which is process remaining time
+ * 
+ * @param  queue            a Queue the process will be added to
+ * @param  p                a process
+ * @return long long int    a priority value
+ */
+long long int prio_remaining_time(Queue *queue, ProcessInfo *p){
+    (void)queue;
+    return p->remaining_time;
+}
+
+
+/**
+ * @brief  Get the priority value which is process level
+ * 
+ * @param  queue            a Queue the process will be added to
+ * @param  p                a process
+ * @return long long int    a priority value
+ */
+long long int prio_level(Queue *queue, ProcessInfo *p){
+    (void)queue;
+    return p->level;
+}
+
+
+/**
+ * @brief  Get the priority value which is process virtual runtime
+ * 
+ * @param  queue            a Queue the process will be added to
+ * @param  p                a process
+ * @return long long int    a priority value
+ */
+long long int prio_vruntime(Queue *queue, ProcessInfo *p){
+    (void)queue;
+    return p->vruntime;
+}
+
+
+/**
+ * @brief  Return the first level with a process in a level queue, there 
+ *         are a fixed number of levels so it takes O(1) time
+ * 
+ * @param  queue            a level Queue
+ * @return long long int    the level, INVALID if the queue is empty
+ */
+long long int get_top_level(Queue *queue){
+    for (long long int level = 0; level < MAX_NUM_LEVEL; level++){
+        if (queue->level_head[level] != NULL){
+            return level;
+        }
+    }
+    return INVALID;
+}
+
+
+/**
+ * @brief  Place a node at a heap index, and record the index in the process
+ *         if the queue is indexed
+ * 
+ * @param  queue    a Queue
+ * @param  index    a heap index
+ * @param  node     a node
+ */
+void place_node(Queue *queue, long long int index, Node node){
+    queue->heap[index] = node;
+    if (queue->is_indexed){
+        node.process->index_pos = index;
+    }
+}
+
+
+/**
+ * @brief  Check if node a should be dequeued before node b
+ * 
+ * @param  a        a node
+ * @param  b        a node
+ * @return int      1 if a has smaller priority value, or the same priority
+ *                  value and smaller process id. Otherwise, 0
+ */
+int is_before(Node *a, Node *b){
+    if (a->priority != b->priority){
+        return a->priority < b->priority;
     }
+    return a->process->p_id < b->process->p_id;
 }
 
 
+/**
+ * @brief  Move a node up the heap until its parent is before it
+ * 
+ * @param  queue    a Queue
+ * @param  index    the heap index of the node
+ */
+void sift_up(Queue *queue, long long int index){
+    Node node = queue->heap[index];
+
+    while (index > ROOT){
+        long long int parent = (index - 1) / 2;
+        if (!is_before(&node, &queue->heap[parent])){
+            break;
+        }
+        place_node(queue, index, queue->heap[parent]);
+        index = parent;
+    }
+    place_node(queue, index, node);
+}
+
 
+/**
+ * @brief  Move a node down the heap until it is before both its children
+ * 
+ * @param  queue    a Queue
+ * @param  index    the heap index of the node
+ */
+void sift_down(Queue *queue, long long int index){
+    Node node = queue->heap[index];
+
+    while (2 * index + 1 < queue->size){
+        // Find the child which should be dequeued first
+        long long int child = 2 * index + 1;
+        if (child + 1 < queue->size 
+            && is_before(&queue->heap[child + 1], &queue->heap[child])){
+            child++;
+        }
 
+        if (!is_before(&queue->heap[child], &node)){
+            break;
+        }
+        place_node(queue, index, queue->heap[child]);
+        index = child;
+    }
+    place_node(queue, index, node);
+}
@@ -2,12 +2,16 @@
  * @file      queue.h
  * @author    Erya Wen (eryaw@student.unimelb.edu.au)
  * @brief     Queue module. It includes
- *              1. creating new queue
+ *              1. creating new queue (a binary heap priority queue)
  *              2. destory a queue
  *              3. inserting elements to the queue
  *              4. deleting elements from the start of the queue
  *              5. getting size of the queue
  *              6. getting specific position elements in the queue
+ *              7. copying a queue into a new queue with another priority
+ *              8. removing a given element from an indexed queue
+ *              9. getting the first elements in priority order
+ *             10. moving all processes of a level queue to the top level
  *
  * @copyright created for COMP30023 Computer System 2020
  *
@@ -19,41 +23,65 @@
 #include "processInfo.h"
 
 
-// ============================================================================
-// == | Constant Definitions 
-// ============================================================================
-#define PRIO_ARRIVAL_T      "ARRT"
-#define PRIO_LAST_EXE_T     "LASTET"
-#define PRIO_JOB_T          "JOBT"
-#define PRIO_MAX_PAGE       "MAXPAGE"
-#define PRIO_COMPLETE_T     "COMPLETET" 
-
-
 // ============================================================================
 // == | Data Type Definitions
 // ============================================================================
 typedef struct queue Queue;
 
+/**
+ * @brief  The priority value a Queue is ordered by, in ascending order.
+ *         It is chosen once when the Queue is created. A Queue ordered by
+ *         level keeps a first-in-first-out list for each level instead
+ */
+typedef enum {
+    PRIO_ARRIVAL_T,
+    PRIO_LAST_EXE_T,
+    PRIO_JOB_T,
+    PRIO_MIN_PAGE,
+    PRIO_COMPLETE_T,
+    PRIO_ENQUEUE_T,
+    PRIO_NEXT_USE,
+    PRIO_IO_DONE_T,
+    PRIO_REMAIN_T,
+    PRIO_LEVEL,
+    PRIO_VRUNTIME
+} QueuePrio;
+
 
 // ============================================================================
 // == | Module Functions
 // ============================================================================
-// Create a new queue and return its pointer
-Queue *new_queue();
+// Create a new queue ordered by a priority and return its pointer
+Queue *new_queue(QueuePrio prio);
+
+// Create a new indexed queue ordered by a priority and return its pointer
+Queue *new_indexed_queue(QueuePrio prio);
 
 // Destroy a queue and free its memory
 void free_queue(Queue *queue);
 
 // Add an element to the queue based on the priority
-void enqueue(Queue *queue, ProcessInfo *p, char *prio_flag);
+void enqueue(Queue *queue, ProcessInfo *p);
 
 // Remove and return the front data element from a queue
 ProcessInfo *dequeue(Queue *queue);
 
+// Remove a given element from an indexed queue if it is in the queue
+void remove_queue_point(Queue *queue, ProcessInfo *p);
+
 // Return the number of elements contained in a queue
 long long int get_queue_size(Queue *queue);
 
-// Return the data of a given index ProcessInfo from a Queue
+// Return the data of a given heap index ProcessInfo from a Queue in O(1)
 ProcessInfo *get_queue_point(Queue *queue, long long int index);
 
+// Create a new queue ordered by a priority with all elements of a queue
+Queue *copy_queue(Queue *queue, QueuePrio prio);
+
+// Get the first number of elements of a queue in priority order
+long long int peek_queue(Queue *queue, ProcessInfo **list, long long int num);
+
+// Move all elements of a queue to the top level
+void boost_queue(Queue *queue);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,162 @@
+/**
+ * @file      replList.c
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Implementation of Replacement list module, doubly linked lists
+ *            of processes ordered from the most to the least recently used, 
+ *            for page replacement. The list links are kept in the processes, 
+ *            each process can be in one list of each slot, so every 
+ *            operation takes O(1) time. It includes
+ *              1. initialising a replacement list
+ *              2. adding a process as the most recently used
+ *              3. removing a process from the list of a slot
+ *              4. getting the least recently used process
+ *              5. changing the number of pages a process is counted as
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#include "replList.h"
+#include "processInfo.h"
+#include "utilities.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+/**
+ * @brief  Initialise an empty ReplList using a slot of the process links
+ * 
+ * @param  list     a ReplList
+ * @param  slot     the slot of the process links
+ */
+void init_ReplList(ReplList *list, int slot) {
+
+    assert(slot >= 0 && slot < NUM_REPL_SLOT);
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->slot = slot;
+    list->size = INITIAL;
+    list->num_page = INITIAL;
+}
+
+
+/**
+ * @brief  Add a process to a ReplList as the most recently used
+ * 
+ * @param  list         a ReplList
+ * @param  p            a ProcessInfo data which is not in a list of the slot
+ * @param  num_page     the number of pages the process is counted as
+ */
+void push_repl(ReplList *list, ProcessInfo *p, long long int num_page) {
+
+    ReplNode *node = &p->repl_node[list->slot];
+    assert(node->list == NULL);
+
+    node->prev = NULL;
+    node->next = list->head;
+    node->list = list;
+    node->num_page = num_page;
+    if (list->head != NULL){
+        list->head->repl_node[list->slot].prev = p;
+    } else {
+        list->tail = p;
+    }
+    list->head = p;
+
+    list->size++;
+    list->num_page += num_page;
+}
+
+
+/**
+ * @brief  Remove a process from the ReplList of a slot it is in, if any
+ * 
+ * @param  p        a ProcessInfo data
+ * @param  slot     the slot of the process links
+ */
+void remove_repl(ProcessInfo *p, int slot) {
+
+    ReplNode *node = &p->repl_node[slot];
+    ReplList *list = node->list;
+    if (list == NULL){
+        return;
+    }
+
+    if (node->prev != NULL){
+        node->prev->repl_node[slot].next = node->next;
+    } else {
+        list->head = node->next;
+    }
+    if (node->next != NULL){
+        node->next->repl_node[slot].prev = node->prev;
+    } else {
+        list->tail = node->prev;
+    }
+
+    list->size--;
+    list->num_page -= node->num_page;
+
+    node->prev = NULL;
+    node->next = NULL;
+    node->list = NULL;
+}
+
+
+/**
+ * @brief  Return the least recently used process of a ReplList
+ * 
+ * @param  list             a ReplList
+ * @return ProcessInfo*     the least recently used process, NULL if empty
+ */
+ProcessInfo *get_repl_lru(ReplList *list) {
+    return list->tail;
+}
+
+
+/**
+ * @brief  Return the next more recently used process in the same ReplList
+ * 
+ * @param  p                a ProcessInfo data
+ * @param  slot             the slot of the process links
+ * @return ProcessInfo*     the next more recently used process, 
+ *                          NULL if it is the most recently used
+ */
+ProcessInfo *get_repl_prev(ProcessInfo *p, int slot) {
+    return p->repl_node[slot].prev;
+}
+
+
+/**
+ * @brief  Return the ReplList of a slot a process is in
+ * 
+ * @param  p            a ProcessInfo data
+ * @param  slot         the slot of the process links
+ * @return ReplList*    the ReplList, NULL if it is in none
+ */
+ReplList *get_repl_list(ProcessInfo *p, int slot) {
+    return p->repl_node[slot].list;
+}
+
+
+/**
+ * @brief  Change the number of pages a process is counted as in the 
+ *         ReplList of a slot, without changing its position
+ * 
+ * @param  p            a ProcessInfo data in a list of the slot
+ * @param  slot         the slot of the process links
+ * @param  num_page     the number of pages the process is counted as
+ */
+void set_repl_page(ProcessInfo *p, int slot, long long int num_page) {
+
+    ReplNode *node = &p->repl_node[slot];
+    assert(node->list != NULL);
+
+    node->list->num_page += num_page - node->num_page;
+    node->num_page = num_page;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file      replList.h
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Replacement list module, doubly linked lists of processes 
+ *            ordered from the most to the least recently used, for page 
+ *            replacement. The list links are kept in the processes, each 
+ *            process can be in one list of each slot. It includes
+ *              1. initialising a replacement list
+ *              2. adding a process as the most recently used
+ *              3. removing a process from the list of a slot
+ *              4. getting the least recently used process
+ *              5. changing the number of pages a process is counted as
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#ifndef REPLLIST_H
+#define REPLLIST_H
+
+
+// ============================================================================
+// == | Constant Definitions 
+// ============================================================================
+#define NUM_REPL_SLOT           3
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+typedef struct repl_list ReplList;
+/**
+ * @brief The ReplList records its most and least recently used processes,
+ *        the slot of the process links it uses, the number of processes
+ *        and the total number of pages of them.
+ */
+struct repl_list {
+    struct process *head;
+    struct process *tail;
+    int slot;
+    long long int size;
+    long long int num_page;
+};
+
+typedef struct repl_node ReplNode;
+/**
+ * @brief The ReplNode is the links of a process in a slot, it records 
+ *        the more and less recently used processes, the list it is in 
+ *        and the number of pages it is counted as.
+ */
+struct repl_node {
+    struct process *prev;
+    struct process *next;
+    ReplList *list;
+    long long int num_page;
+};
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+// Initialise an empty ReplList using a slot of the process links
+void init_ReplList(ReplList *list, int slot);
+
+// Add a process to a ReplList as the most recently used
+void push_repl(ReplList *list, struct process *p, long long int num_page);
+
+// Remove a process from the ReplList of a slot it is in, if any
+void remove_repl(struct process *p, int slot);
+
+// Return the least recently used process of a ReplList
+struct process *get_repl_lru(ReplList *list);
+
+// Return the next more recently used process in the same ReplList
+struct process *get_repl_prev(struct process *p, int slot);
+
+// Return the ReplList of a slot a process is in, NULL if it is in none
+ReplList *get_repl_list(struct process *p, int slot);
+
+// Change the number of pages a process is counted as in its ReplList
+void set_repl_page(struct process *p, int slot, long long int num_page);
+
+#endif
@@ -4,6 +4,20 @@
  * @brief     Implementation of Schedluing Simulation module. It includes
  *              1. simulate processes running on CPU based on scheduling algorithm
  *              2. update the performence statistic
+ *              3. load pages by the I/O device while other processes run
+ *              4. simulate processes running on multiple cores, each with 
+ *                 its own run queue, idle cores steal processes from the 
+ *                 busiest run queue
+ *              5. run processes on cores of different speeds, and place 
+ *                 long processes on fast cores
+ *              6. preempt the running process when a process with a 
+ *                 shorter remaining time arrives
+ *              7. run processes from multiple levels of priority, a process
+ *                 using up the quantum of its level moves down a level, and
+ *                 all processes move back to the top level periodically
+ *              8. run the process with the smallest virtual runtime for a
+ *                 time slice of the target latency, its virtual runtime
+ *                 grows slower if its nice value is lower
  *
  * @copyright created for COMP30023 Computer System 2020
  *
@@ -19,15 +33,76 @@
 #include <unistd.h>
 
 
+// ============================================================================
+// == | Constant Definitions 
+// ============================================================================
+#define NICE_0_WEIGHT           1024
+
+
 // ============================================================================
 // == | Function Prototypes
 // ============================================================================
-// Update current time after process execution finished
-void add_curr_time(char sched_algo_f, CPUInfo *cpu, ProcessInfo *p);
+// Update current time after process execution finished on a core of a speed
+void add_curr_time(char sched_algo_f, CPUInfo *cpu, ProcessInfo *p, 
+                    long long int speed, long long int num_wait);
+
+// Return the time slice of a process when a number of processes can run
+long long int get_time_slice(CPUInfo *cpu, long long int num_runnable);
+
+// Return the virtual runtime of executing for a time with a nice value
+long long int get_vruntime(long long int exe_time, long long int nice);
+
+// Update the smallest virtual runtime of the processes in a run queue
+void update_min_vruntime(long long int *min_vruntime, Queue *run_queue);
+
+// Return the time a core of a speed takes to execute an amount of work
+long long int scale_time(long long int work, long long int speed);
+
+// Run a process until it finishes or a shorter process arrives
+void run_srtf(CPUInfo *cpu, ProcessInfo *p, Queue *queue, 
+                Queue *waiting_queue);
+
+// Put the processes arrived into the waiting queue, return the shortest
+long long int add_srtf_arrival(CPUInfo *cpu, Queue *queue, 
+                                Queue *waiting_queue);
+
+// Return if a process can stop running before it finishes
+int is_preemptive(char sched_algo_f);
+
+// Move all processes to the top level once the boost period passes
+void boost_priority(CPUInfo *cpu, Queue **queue_lst, long long int num_queue);
 
 // Update the turnaround time and time overhead for statistics
 void record_statistic(CPUInfo *cpu, ProcessInfo *p);
 
+// Put the processes whose pages finish loading into the waiting queue
+void complete_loading(CPUInfo *cpu, Queue *io_queue, Queue *waiting_queue);
+
+// Put the processes which arrived into the waiting queue
+void add_arrival(CPUInfo *cpu, Queue *queue, Queue *waiting_queue);
+
+// Simulate to allocates processes to the cores of a multi-core CPU
+Queue *simulate_cores(char sched_algo_f, char mem_alloc_f, Queue *queue, 
+                        CPUInfo *cpu, QueuePrio wait_prio);
+
+// Return the core which has the next event
+CoreInfo *get_next_core(CPUInfo *cpu);
+
+// Return the core with the fewest processes running and waiting on it
+CoreInfo *get_idlest_core(CPUInfo *cpu, CoreInfo *local);
+
+// Return the core a process arrived is placed on
+CoreInfo *place_core(CPUInfo *cpu, CoreInfo *local, ProcessInfo *p);
+
+// Put the processes which arrived into the run queues of the cores
+void add_core_arrival(CPUInfo *cpu, CoreInfo *local, Queue *queue);
+
+// Move a process from the busiest run queue to the run queue of a core
+void steal_process(CPUInfo *cpu, CoreInfo *core);
+
+// Return the number of processes running and waiting on all cores
+long long int count_core_process(CPUInfo *cpu);
+
 
 // ============================================================================
 // == | Main Functions
@@ -49,17 +124,83 @@ Queue *simulation(char sched_algo_f, char mem_alloc_f,
     assert(queue != NULL);
     assert(cpu != NULL);
 
+    /**
+     * The order of the waiting queue is based on the sheduling algorithms.
+     * If scheduling algorithm is Customised Scheduling, which is Short Job 
+     * First in this project, a process with short job time will run first.
+     * If scheduling algorithm is First-come first-served, a process with
+     * early arrival time will run first.
+     * If scheduling algorithm is Round-robin, processes run in the order 
+     * they are added to the waiting queue.
+     * If scheduling algorithm is Shortest Remaining Time First, a process 
+     * with short remaining time will run first.
+     * If scheduling algorithm is Multi-level Feedback Queue, a process in 
+     * a higher level will run first, and processes in the same level run 
+     * in the order they are added to the waiting queue.
+     * If scheduling algorithm is Completely Fair Scheduling, a process 
+     * with small virtual runtime will run first
+     */
+    QueuePrio wait_prio = PRIO_ARRIVAL_T;
+    if (sched_algo_f == CS_A_FLAG){
+        wait_prio = PRIO_JOB_T;
+    } else if (sched_algo_f == RR_A_FLAG){
+        wait_prio = PRIO_ENQUEUE_T;
+    } else if (sched_algo_f == SR_A_FLAG){
+        wait_prio = PRIO_REMAIN_T;
+    } else if (sched_algo_f == ML_A_FLAG){
+        wait_prio = PRIO_LEVEL;
+    } else if (sched_algo_f == CF_A_FLAG){
+        wait_prio = PRIO_VRUNTIME;
+    }
+
+    // Each core of a multi-core CPU, or a core of a speed, has its own run queue
+    if (cpu->num_core > 1 || cpu->speed_lst != NULL){
+        return simulate_cores(sched_algo_f, mem_alloc_f, queue, cpu, 
+                                wait_prio);
+    }
+
     // A queue that record the process waiting to be executed
-    Queue *waiting_queue = new_queue();
+    Queue *waiting_queue = new_queue(wait_prio);
     if (get_queue_size(queue) > 0){
-        enqueue(waiting_queue, dequeue(queue), PRIO_ARRIVAL_T);
+        enqueue(waiting_queue, dequeue(queue));
     }
     
     // A queue that record the completed process 
-    Queue *complete_queue = new_queue();
+    Queue *complete_queue = new_queue(PRIO_COMPLETE_T);
+
+    // A queue that record the process suspended by the load control
+    Queue *suspend_queue = new_queue(PRIO_ENQUEUE_T);
+
+    /**
+     * A queue that record the process whose pages are being loaded by the 
+     * I/O device, and a queue that record the process which can not be 
+     * allocated until a process being loaded runs
+     */
+    Queue *io_queue = new_queue(PRIO_IO_DONE_T);
+    Queue *blocked_queue = new_queue(PRIO_ENQUEUE_T);
     
     // Simulation of loading and executing the process
-    while(get_queue_size(waiting_queue) > 0 || get_queue_size(queue) > 0){
+    while(get_queue_size(waiting_queue) > 0 || get_queue_size(queue) > 0
+            || get_queue_size(suspend_queue) > 0 
+            || get_queue_size(io_queue) > 0
+            || get_queue_size(blocked_queue) > 0){
+
+        // All processes not running move back to the top level periodically
+        if (sched_algo_f == ML_A_FLAG){
+            Queue *queue_lst[] = {waiting_queue, suspend_queue, io_queue, 
+                                    blocked_queue};
+            boost_priority(cpu, queue_lst, 4);
+        }
+
+        /**
+         * Resume a suspended process once the memory is no longer 
+         * thrashing, or if there is no other process to run
+         */
+        if (get_queue_size(suspend_queue) > 0 
+            && (get_queue_size(waiting_queue) == 0 
+                || !is_mem_thrashing(mem_alloc_f, cpu))){
+            enqueue(waiting_queue, dequeue(suspend_queue));
+        }
         
         if (get_queue_size(waiting_queue) > 0){
             /** 
@@ -68,62 +209,120 @@ Queue *simulation(char sched_algo_f, char mem_alloc_f,
              */ 
             ProcessInfo *p = dequeue(waiting_queue);
 
-            // Allocate process to CPU
-            mem_alloc_func(mem_alloc_f, waiting_queue, cpu, p);
+            if (p->io_done_time != INVALID){
+                // The pages of the process are loaded, it runs now
+                p->io_done_time = INVALID;
+                mem_loaded_func(cpu, p);
+
+            } else {
+                /**
+                 * A process is suspended if the memory is thrashing, 
+                 * unless it is the only process can run
+                 */
+                if (get_queue_size(waiting_queue) > 0 
+                    && !mem_admit_func(mem_alloc_f, cpu, p)){
+                    enqueue(suspend_queue, p);
+                    continue;
+                }
+
+                /**
+                 * A process waits if its pages can not fit in the memory 
+                 * with the pages being loaded
+                 */
+                if (cpu->io != NULL && !mem_can_load_func(mem_alloc_f, cpu, p)){
+                    enqueue(blocked_queue, p);
+                    continue;
+                }
+
+                // Record the order processes run for the oracle
+                if (cpu->oracle != NULL){
+                    dispatch_oracle(cpu->oracle, p);
+                }
+
+                // Allocate process to CPU
+                mem_alloc_func(mem_alloc_f, cpu, p);
+
+                /**
+                 * The I/O device loads the pages of the process, and the 
+                 * CPU runs another process meanwhile
+                 */
+                if (cpu->io != NULL && p->load_time > 0){
+                    p->io_done_time = issue_io(cpu->io, cpu->curr_time, 
+                                                p->load_time);
+                    cpu->total_load_time += p->load_time;
+                    mem_load_func(cpu, p);
+                    enqueue(io_queue, p);
+                    continue;
+                }
+            }
 
             // Record current time after the process loading and executing 
-            add_curr_time(sched_algo_f, cpu, p);
+            long long int exe_time = cpu->total_exe_time;
+            if (sched_algo_f == SR_A_FLAG){
+                run_srtf(cpu, p, queue, waiting_queue);
+            } else {
+                add_curr_time(sched_algo_f, cpu, p, BASE_SPEED, 
+                                get_queue_size(waiting_queue));
+            }
+            exe_time = cpu->total_exe_time - exe_time;
             
             /**
-             * If there are other processes arrival during a process running,
-             * put there into waiting queue based on the sheduling algorithms
+             * If there are other processes arrival or finish loading during 
+             * a process running, put there into waiting queue based on the 
+             * sheduling algorithms
              */
-            while(get_queue_size(queue) > 0){
-                ProcessInfo *p = get_queue_point(queue, 0);
-                if (p->arrive_time <= cpu->curr_time){
-                    if(sched_algo_f == CS_A_FLAG){
-                        /**
-                         * If scheduling algorithm is Customised Scheduling, which 
-                         * is Short Job First in this project, a process with
-                         * short job time will run first
-                         */
-                        enqueue(waiting_queue, dequeue(queue), PRIO_JOB_T);
-                    } else if (sched_algo_f == FF_A_FLAG 
-                            || sched_algo_f == RR_A_FLAG){
-
-                        /**
-                         * If scheduling algorithm is First-come first-served, 
-                         * or Round-robin, a process with early arrival time
-                         * will run first
-                         */
-                        enqueue(waiting_queue, dequeue(queue), PRIO_ARRIVAL_T);
-                    }
-                    
-                } else {
-                    break;
-                }
-            } 
+            add_arrival(cpu, queue, waiting_queue);
+            complete_loading(cpu, io_queue, waiting_queue);
+
+            // Prefetch pages of the next processes while the process executes
+            mem_prefetch_func(mem_alloc_f, cpu, waiting_queue, exe_time);
+
+            // The processes waiting for memory can be allocated again
+            while (get_queue_size(blocked_queue) > 0){
+                enqueue(waiting_queue, dequeue(blocked_queue));
+            }
 
             // Update the process lastest execution time
             p->last_execution_time = cpu->curr_time;
 
-            if(sched_algo_f == RR_A_FLAG && p->remaining_time != 0){
+            if(is_preemptive(sched_algo_f) && p->remaining_time != 0){
                 /**
                  * When the total running time for a process 
                  * haven't reached its specificed job-time
                  */
-                enqueue(waiting_queue, p, PRIO_LAST_EXE_T);
+                enqueue(waiting_queue, p);
+                mem_suspend_func(mem_alloc_f, cpu, p);
 
             } else {
                 // When a process finised running its specificed job-time
                 record_statistic(cpu, p);
-                print_finished(mem_alloc_f, cpu, p, waiting_queue);
+                print_finished(mem_alloc_f, cpu, p, get_queue_size(waiting_queue)
+                                        + get_queue_size(suspend_queue)
+                                        + get_queue_size(io_queue)
+                                        + get_queue_size(blocked_queue));
 
                 p->complete_time = cpu->curr_time;
-                enqueue(complete_queue, p, PRIO_COMPLETE_T);
+                enqueue(complete_queue, p);
                 cpu->complete_num_process += 1;
             }
 
+            // The processes arrive later start from the smallest virtual runtime
+            if (sched_algo_f == CF_A_FLAG){
+                update_min_vruntime(&cpu->min_vruntime, waiting_queue);
+            }
+
+        } else if (get_queue_size(io_queue) > 0 
+                    && (get_queue_size(queue) == 0 
+                        || get_queue_point(io_queue, 0)->io_done_time 
+                            <= get_queue_point(queue, 0)->arrive_time)){
+            /**
+             * If currently there are not process in the waiting queue, 
+             * wait till the pages of the next process finish loading
+             */
+            cpu->curr_time = get_queue_point(io_queue, 0)->io_done_time;
+            add_arrival(cpu, queue, waiting_queue);
+            complete_loading(cpu, io_queue, waiting_queue);
+
         } else {
             /**
              * If currently there are not process in the waiting queue, 
@@ -131,7 +330,8 @@ Queue *simulation(char sched_algo_f, char mem_alloc_f,
              */
             if (get_queue_size(queue) > 0){
                 ProcessInfo *p = dequeue(queue);
-                enqueue(waiting_queue, p, PRIO_ARRIVAL_T);
+                p->vruntime = cpu->min_vruntime;
+                enqueue(waiting_queue, p);
                 cpu->curr_time = p->arrive_time;
             }
         }
@@ -140,6 +340,9 @@ Queue *simulation(char sched_algo_f, char mem_alloc_f,
 
 
     free_queue(waiting_queue);
+    free_queue(suspend_queue);
+    free_queue(io_queue);
+    free_queue(blocked_queue);
     return complete_queue;
 }
 
@@ -148,33 +351,72 @@ Queue *simulation(char sched_algo_f, char mem_alloc_f,
 // == | Auxillary Functions 
 // ============================================================================
 /**
- * @brief  Update current time after process execution finished
+ * @brief  Update current time after process execution finished on a core 
+ *         of a speed. The job-time is the time it executes at the base 
+ *         speed, a faster core executes it in a shorter time. Loading takes 
+ *         the same time on any core. Shortest Remaining Time First runs 
+ *         on a single CPU by run_srtf() instead
  * 
  * @param  sched_algo_f     scheduling algorithm flag
  * @param  cpu              a CPUInfo data
  * @param  p                a ProcessInfo data
+ * @param  speed            the speed of the core, a percentage of the base 
+ *                          speed
+ * @param  num_wait         number of other processes waiting to run
  */
-void add_curr_time(char sched_algo_f, CPUInfo *cpu, ProcessInfo *p){
+void add_curr_time(char sched_algo_f, CPUInfo *cpu, ProcessInfo *p, 
+                    long long int speed, long long int num_wait){
+
+    assert(sched_algo_f != SR_A_FLAG);
+
+    long long int start_time = cpu->curr_time;
 
     if (sched_algo_f == FF_A_FLAG){
         /**
          * If scheduling algorithm is First-come first-served, a process loads
          * and executs until total running time reaches the specified job-time
          */
-        cpu->curr_time += p->job_time + p->load_time;
+        cpu->curr_time += scale_time(p->job_time, speed) + p->load_time;
 
-    } else if (sched_algo_f == RR_A_FLAG){
+    } else if (sched_algo_f == RR_A_FLAG || sched_algo_f == ML_A_FLAG
+                || sched_algo_f == CF_A_FLAG){
         /**
          * If scheduling algorithm is Round Robin, a process loads
-         * and executs shorter or equal to the maximum limited time (quantam)
+         * and executs shorter or equal to the maximum limited time (quantam),
+         * the work done within the quantam depends on the speed.
+         * If scheduling algorithm is Multi-level Feedback Queue, the quantam
+         * is the quantam of the level of the process, it moves down a 
+         * level if it uses up the quantam and does not finish.
+         * If scheduling algorithm is Completely Fair Scheduling, the 
+         * quantam is the time slice, and its virtual runtime grows by the 
+         * time it executes, weighted by its nice value
          */
-        if (p->remaining_time >= cpu->quantam){ 
-            p->remaining_time -= cpu->quantam;
-            cpu->curr_time += cpu->quantam + p->load_time; 
+        long long int quantam = cpu->quantam;
+        if (sched_algo_f == ML_A_FLAG){
+            quantam = cpu->level_quantam[p->level];
+        } else if (sched_algo_f == CF_A_FLAG){
+            quantam = get_time_slice(cpu, num_wait + 1);
+        }
+        long long int quantam_work = quantam * speed / BASE_SPEED;
+        if (quantam_work < 1){
+            quantam_work = 1;
+        }
+        if (p->remaining_time >= quantam_work){ 
+            p->remaining_time -= quantam_work;
+            cpu->curr_time += scale_time(quantam_work, speed) + p->load_time; 
         } else {
-            cpu->curr_time += p->remaining_time + p->load_time;
+            cpu->curr_time += scale_time(p->remaining_time, speed) 
+                                + p->load_time;
             p->remaining_time = 0;
         }
+        if (sched_algo_f == ML_A_FLAG && p->remaining_time > 0 
+            && p->level < cpu->num_level - 1){
+            p->level++;
+        }
+        if (sched_algo_f == CF_A_FLAG){
+            p->vruntime += get_vruntime(cpu->curr_time - start_time 
+                                        - p->load_time, p->nice);
+        }
 
     } else if (sched_algo_f == CS_A_FLAG){
         /**
@@ -182,8 +424,206 @@ void add_curr_time(char sched_algo_f, CPUInfo *cpu, ProcessInfo *p){
          * Short Job First in this project, a process loads and executs until 
          * total running time reaches the specified job-time
          */
-        cpu->curr_time += p->job_time + p->load_time;
+        cpu->curr_time += scale_time(p->job_time, speed) + p->load_time;
     } 
+
+    cpu->total_load_time += p->load_time;
+    cpu->total_exe_time += cpu->curr_time - start_time - p->load_time;
+}
+
+
+/**
+ * @brief  Return the time a core of a speed takes to execute an amount of 
+ *         work, which takes the same time at the base speed
+ * 
+ * @param  work             the amount of work
+ * @param  speed            the speed, a percentage of the base speed
+ * @return long long int    the time
+ */
+long long int scale_time(long long int work, long long int speed){
+    return (work * BASE_SPEED + speed - 1) / speed;
+}
+
+
+/**
+ * @brief  Run a process for Shortest Remaining Time First, it loads and 
+ *         executes until it finishes, or until a process arrives with a 
+ *         shorter remaining time than it has then, which preempts it. The
+ *         processes arrived while it loads are compared when it starts 
+ *         executing. Only the processes arrived are compared, a process 
+ *         waiting before it loads does not preempt it even if page faults
+ *         make its remaining time longer, so it always makes progress
+ * 
+ * @param  cpu              a CPUInfo data
+ * @param  p                a ProcessInfo data
+ * @param  queue            a queue of processes not arrived yet
+ * @param  waiting_queue    a queue of processes waiting to be executed
+ */
+void run_srtf(CPUInfo *cpu, ProcessInfo *p, Queue *queue, 
+                Queue *waiting_queue){
+
+    long long int start_time = cpu->curr_time;
+    cpu->curr_time += p->load_time;
+    long long int shortest = add_srtf_arrival(cpu, queue, waiting_queue);
+
+    while (p->remaining_time > 0){
+
+        // A process arrived with a shorter remaining time preempts it
+        if (shortest != INVALID && shortest < p->remaining_time){
+            break;
+        }
+
+        // Execute until the next process arrives, or until it finishes
+        long long int finish_time = cpu->curr_time + p->remaining_time;
+        if (get_queue_size(queue) > 0 
+            && get_queue_point(queue, 0)->arrive_time < finish_time){
+            long long int arrive_time = get_queue_point(queue, 0)->arrive_time;
+            p->remaining_time -= arrive_time - cpu->curr_time;
+            cpu->curr_time = arrive_time;
+            shortest = add_srtf_arrival(cpu, queue, waiting_queue);
+        } else {
+            cpu->curr_time = finish_time;
+            p->remaining_time = 0;
+        }
+    }
+
+    cpu->total_load_time += p->load_time;
+    cpu->total_exe_time += cpu->curr_time - start_time - p->load_time;
+}
+
+
+/**
+ * @brief  Put the processes which arrived into the waiting queue for 
+ *         Shortest Remaining Time First, and return the shortest remaining
+ *         time of them
+ * 
+ * @param  cpu              a CPUInfo data
+ * @param  queue            a queue of processes not arrived yet
+ * @param  waiting_queue    a queue of processes waiting to be executed
+ * @return long long int    the shortest remaining time, INVALID if no 
+ *                          process arrived
+ */
+long long int add_srtf_arrival(CPUInfo *cpu, Queue *queue, 
+                                Queue *waiting_queue){
+    long long int shortest = INVALID;
+    while(get_queue_size(queue) > 0 
+            && get_queue_point(queue, 0)->arrive_time <= cpu->curr_time){
+        ProcessInfo *p = dequeue(queue);
+        if (shortest == INVALID || p->remaining_time < shortest){
+            shortest = p->remaining_time;
+        }
+        enqueue(waiting_queue, p);
+    }
+    return shortest;
+}
+
+
+/**
+ * @brief  Return the time slice of a process for Completely Fair 
+ *         Scheduling, the processes can run share the target latency, 
+ *         and each runs for at least the quantam
+ * 
+ * @param  cpu              a CPUInfo data
+ * @param  num_runnable     number of processes can run, including it
+ * @return long long int    the time slice
+ */
+long long int get_time_slice(CPUInfo *cpu, long long int num_runnable){
+    long long int slice = cpu->target_latency / num_runnable;
+    if (slice < cpu->quantam){
+        slice = cpu->quantam;
+    }
+    return slice;
+}
+
+
+/**
+ * @brief  Return the virtual runtime of executing for a time with a nice 
+ *         value. The weight of a nice value is about 1.25 times the weight
+ *         of the nice value one higher, as in Linux. It is measured in 
+ *         units of 1/1024 of the time a process of nice value 0 executes,
+ *         so heavy weights still make it grow
+ * 
+ * @param  exe_time         the time executed
+ * @param  nice             the nice value, from -20 to 19
+ * @return long long int    the virtual runtime
+ */
+long long int get_vruntime(long long int exe_time, long long int nice){
+    long long int nice_weight[MAX_NICE - MIN_NICE + 1] = {
+        88761, 71755, 56483, 46273, 36291, 29154, 23254, 18705, 14949, 11916,
+        9548, 7620, 6100, 4904, 3906, 3121, 2501, 1991, 1586, 1277,
+        1024, 820, 655, 526, 423, 335, 272, 215, 172, 137,
+        110, 87, 70, 56, 45, 36, 29, 23, 18, 15
+    };
+    assert(nice >= MIN_NICE && nice <= MAX_NICE);
+    return exe_time * NICE_0_WEIGHT * NICE_0_WEIGHT 
+            / nice_weight[nice - MIN_NICE];
+}
+
+
+/**
+ * @brief  Update the smallest virtual runtime of the processes waiting in a
+ *         run queue, it never decreases. A process arrived starts from it, 
+ *         so it does not run for long before the others run again
+ * 
+ * @param  min_vruntime     the smallest virtual runtime of the run queue
+ * @param  run_queue        a run queue ordered by virtual runtime
+ */
+void update_min_vruntime(long long int *min_vruntime, Queue *run_queue){
+    if (get_queue_size(run_queue) > 0 
+        && get_queue_point(run_queue, 0)->vruntime > *min_vruntime){
+        *min_vruntime = get_queue_point(run_queue, 0)->vruntime;
+    }
+}
+
+
+/**
+ * @brief  Return if a process can stop running before it finishes, then 
+ *         it waits to run again
+ * 
+ * @param  sched_algo_f     scheduling algorithm flag
+ * @return int              1 if it is Round Robin, Shortest Remaining Time
+ *                          First, Multi-level Feedback Queue or Completely
+ *                          Fair Scheduling, 0 otherwise
+ */
+int is_preemptive(char sched_algo_f){
+    return sched_algo_f == RR_A_FLAG || sched_algo_f == SR_A_FLAG 
+            || sched_algo_f == ML_A_FLAG || sched_algo_f == CF_A_FLAG;
+}
+
+
+/**
+ * @brief  Move all processes to the top level once the boost period 
+ *         passes, so the processes in low levels do not starve. The 
+ *         processes in the queues are moved, and for multiple cores, the 
+ *         processes in the run queues and running on the cores
+ * 
+ * @param  cpu          a CPUInfo data
+ * @param  queue_lst    a list of queues of processes not running
+ * @param  num_queue    number of queues in the list
+ */
+void boost_priority(CPUInfo *cpu, Queue **queue_lst, long long int num_queue){
+
+    if (cpu->curr_time < cpu->next_boost){
+        return;
+    }
+
+    for (long long int i = 0; i < num_queue; i++){
+        boost_queue(queue_lst[i]);
+    }
+    if (cpu->core_lst != NULL){
+        for (long long int i = 0; i < cpu->num_core; i++){
+            CoreInfo *core = cpu->core_lst[i];
+            boost_queue(core->run_queue);
+            if (core->running != NULL){
+                core->running->level = 0;
+            }
+        }
+    }
+
+    // The next boost is at the next multiple of the period
+    cpu->num_boost++;
+    cpu->next_boost = (cpu->curr_time / cpu->boost_period + 1) 
+                        * cpu->boost_period;
 }
 
 
@@ -205,3 +645,405 @@ void record_statistic(CPUInfo *cpu, ProcessInfo *p){
         cpu->max_time_overh = time_overh;
     }
 }
+
+
+/**
+ * @brief  Put the processes whose pages finish loading by the I/O device 
+ *         into the waiting queue
+ * 
+ * @param  cpu              a CPUInfo data
+ * @param  io_queue         a queue of processes being loaded
+ * @param  waiting_queue    a queue of processes waiting to be executed
+ */
+void complete_loading(CPUInfo *cpu, Queue *io_queue, Queue *waiting_queue){
+    while(get_queue_size(io_queue) > 0){
+        ProcessInfo *p = get_queue_point(io_queue, 0);
+        if (p->io_done_time <= cpu->curr_time){
+            complete_io(cpu->io);
+            enqueue(waiting_queue, dequeue(io_queue));
+        } else {
+            break;
+        }
+    }
+}
+
+
+/**
+ * @brief  Put the processes which arrived into the waiting queue
+ * 
+ * @param  cpu              a CPUInfo data
+ * @param  queue            a queue of processes not arrived yet
+ * @param  waiting_queue    a queue of processes waiting to be executed
+ */
+void add_arrival(CPUInfo *cpu, Queue *queue, Queue *waiting_queue){
+    while(get_queue_size(queue) > 0){
+        ProcessInfo *p = get_queue_point(queue, 0);
+        if (p->arrive_time <= cpu->curr_time){
+            p->vruntime = cpu->min_vruntime;
+            enqueue(waiting_queue, dequeue(queue));
+        } else {
+            break;
+        }
+    }
+}
+
+
+/**
+ * @brief  Simulate to allocates processes to the cores of a multi-core CPU,
+ *         which share the memory. The next event happens on the core which 
+ *         is free the earliest, the process running on it stops and it runs
+ *         the next process of its run queue. A process arrived joins the run
+ *         queue of the idlest core, and a process stopped before it 
+ *         finishes joins the run queue of its core again. A core with an 
+ *         empty run queue steals a process from the busiest run queue, or 
+ *         waits till the next process arrival or another core is free
+ * 
+ * @param  sched_algo_f     a scheduling algorithm flag
+ * @param  mem_alloc_f      a memory allocation flag
+ * @param  queue            a queue
+ * @param  cpu              a CPUInfo data
+ * @param  wait_prio        the priority the run queues are ordered by
+ * @return Queue*           a queue with completed process
+ */
+Queue *simulate_cores(char sched_algo_f, char mem_alloc_f, Queue *queue, 
+                        CPUInfo *cpu, QueuePrio wait_prio){
+
+    cpu->core_lst = (CoreInfo **)malloc(cpu->num_core * sizeof(CoreInfo *));
+    if (cpu->core_lst == NULL) {
+        fprintf(stderr, "Error: simulate_cores() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+    for (long long int i = 0; i < cpu->num_core; i++){
+        long long int speed = BASE_SPEED;
+        if (cpu->speed_lst != NULL){
+            speed = cpu->speed_lst[i];
+        }
+        cpu->core_lst[i] = new_CoreInfo(i, speed, wait_prio);
+    }
+
+    // A queue that record the completed process 
+    Queue *complete_queue = new_queue(PRIO_COMPLETE_T);
+
+    // A queue that record the process suspended by the load control
+    Queue *suspend_queue = new_queue(PRIO_ENQUEUE_T);
+
+    /**
+     * A queue that record the process which can not be allocated until 
+     * a process running on another core stops
+     */
+    Queue *blocked_queue = new_queue(PRIO_ENQUEUE_T);
+
+    while(get_queue_size(queue) > 0 || get_queue_size(suspend_queue) > 0
+            || get_queue_size(blocked_queue) > 0 
+            || count_core_process(cpu) > 0){
+
+        CoreInfo *core = get_next_core(cpu);
+        cpu->curr_time = core->curr_time;
+
+        /**
+         * All processes move back to the top level periodically, including
+         * the processes running on the cores
+         */
+        if (sched_algo_f == ML_A_FLAG){
+            Queue *queue_lst[] = {suspend_queue, blocked_queue};
+            boost_priority(cpu, queue_lst, 2);
+        }
+
+        if (core->running != NULL){
+            // The process running on the core stops
+            ProcessInfo *p = core->running;
+            core->running = NULL;
+            mem_release_func(cpu, p);
+            p->core_id = INVALID;
+
+            add_core_arrival(cpu, core, queue);
+
+            // The processes waiting for memory can be allocated again
+            while (get_queue_size(blocked_queue) > 0){
+                enqueue(get_idlest_core(cpu, core)->run_queue, 
+                        dequeue(blocked_queue));
+            }
+
+            // Update the process lastest execution time
+            p->last_execution_time = cpu->curr_time;
+
+            if(is_preemptive(sched_algo_f) && p->remaining_time != 0){
+                enqueue(core->run_queue, p);
+                mem_suspend_func(mem_alloc_f, cpu, p);
+
+            } else {
+                record_statistic(cpu, p);
+                print_finished(mem_alloc_f, cpu, p, count_core_process(cpu)
+                                        + get_queue_size(suspend_queue)
+                                        + get_queue_size(blocked_queue));
+
+                p->complete_time = cpu->curr_time;
+                enqueue(complete_queue, p);
+                cpu->complete_num_process += 1;
+            }
+
+            // The processes arrive later start from the smallest virtual runtime
+            if (sched_algo_f == CF_A_FLAG){
+                update_min_vruntime(&core->min_vruntime, core->run_queue);
+            }
+        }
+        add_core_arrival(cpu, core, queue);
+
+        /**
+         * Resume a suspended process once the memory is no longer 
+         * thrashing, or if there is no other process to run
+         */
+        if (get_queue_size(suspend_queue) > 0 
+            && (count_core_process(cpu) == 0 
+                || !is_mem_thrashing(mem_alloc_f, cpu))){
+            enqueue(get_idlest_core(cpu, core)->run_queue, 
+                    dequeue(suspend_queue));
+        }
+
+        if (get_queue_size(core->run_queue) == 0){
+            steal_process(cpu, core);
+        }
+
+        if (get_queue_size(core->run_queue) == 0){
+            /**
+             * If there is no process to run, wait till the next process 
+             * arrival or till another core is free, if there is one
+             */
+            long long int next_time = INVALID;
+            if (get_queue_size(queue) > 0){
+                next_time = get_queue_point(queue, 0)->arrive_time;
+            }
+            for (long long int i = 0; i < cpu->num_core; i++){
+                CoreInfo *other = cpu->core_lst[i];
+                if (other->running != NULL && (next_time == INVALID 
+                    || other->curr_time < next_time)){
+                    next_time = other->curr_time;
+                }
+            }
+            if (next_time != INVALID){
+                assert(next_time >= core->curr_time);
+                core->curr_time = next_time;
+            }
+            continue;
+        }
+
+        ProcessInfo *p = dequeue(core->run_queue);
+
+        /**
+         * A process is suspended if the memory is thrashing, 
+         * unless it is the only process can run
+         */
+        if (count_core_process(cpu) > 0 
+            && !mem_admit_func(mem_alloc_f, cpu, p)){
+            enqueue(suspend_queue, p);
+            continue;
+        }
+
+        /**
+         * A process waits if its pages can not fit in the memory with the 
+         * pages of the processes running on other cores
+         */
+        if (!mem_can_load_func(mem_alloc_f, cpu, p)){
+            enqueue(blocked_queue, p);
+            continue;
+        }
+
+        // Record the order processes run for the oracle
+        if (cpu->oracle != NULL){
+            dispatch_oracle(cpu->oracle, p);
+        }
+
+        // Allocate process to the core
+        p->core_id = core->core_id;
+        mem_alloc_func(mem_alloc_f, cpu, p);
+
+        // Record the time the core is free after the process runs
+        long long int exe_time = cpu->total_exe_time;
+        add_curr_time(sched_algo_f, cpu, p, core->speed, 
+                        get_queue_size(core->run_queue));
+        exe_time = cpu->total_exe_time - exe_time;
+        core->exe_time += exe_time;
+        core->curr_time = cpu->curr_time;
+        core->running = p;
+        mem_load_func(cpu, p);
+
+        /**
+         * Prefetch pages of the next processes of the core while the 
+         * process executes, from the time it starts
+         */
+        cpu->curr_time -= exe_time + p->load_time;
+        mem_prefetch_func(mem_alloc_f, cpu, core->run_queue, exe_time);
+    }
+
+    free_queue(suspend_queue);
+    free_queue(blocked_queue);
+    return complete_queue;
+}
+
+
+/**
+ * @brief  Return the core which has the next event, it is the core free 
+ *         the earliest. Of the cores free at the same time, a core with a
+ *         process running on it stops the process first
+ * 
+ * @param  cpu          a CPUInfo data
+ * @return CoreInfo*    the core
+ */
+CoreInfo *get_next_core(CPUInfo *cpu){
+    CoreInfo *next = cpu->core_lst[0];
+    for (long long int i = 1; i < cpu->num_core; i++){
+        CoreInfo *core = cpu->core_lst[i];
+        if (core->curr_time < next->curr_time 
+            || (core->curr_time == next->curr_time 
+                && core->running != NULL && next->running == NULL)){
+            next = core;
+        }
+    }
+    return next;
+}
+
+
+/**
+ * @brief  Return the core with the fewest processes running and waiting on
+ *         it. If there are more than one, it is the local core (of the 
+ *         current event) if it is one of them, otherwise the core with the 
+ *         smallest id
+ * 
+ * @param  cpu          a CPUInfo data
+ * @param  local        the CoreInfo data of the current event
+ * @return CoreInfo*    the core
+ */
+CoreInfo *get_idlest_core(CPUInfo *cpu, CoreInfo *local){
+    CoreInfo *idlest = local;
+    long long int min_load = get_queue_size(local->run_queue) 
+                                + (local->running != NULL);
+    for (long long int i = 0; i < cpu->num_core; i++){
+        CoreInfo *core = cpu->core_lst[i];
+        long long int load = get_queue_size(core->run_queue) 
+                                + (core->running != NULL);
+        if (load < min_load){
+            idlest = core;
+            min_load = load;
+        }
+    }
+    return idlest;
+}
+
+
+/**
+ * @brief  Return the core a process arrived is placed on. For speed-aware 
+ *         placement, a long process (its job-time is at least the average 
+ *         of the processes arrived) is placed on the idlest core faster 
+ *         than the average speed, and a short process on the idlest of the
+ *         other cores. Otherwise, it is placed on the idlest core
+ * 
+ * @param  cpu          a CPUInfo data
+ * @param  local        the CoreInfo data of the current event
+ * @param  p            a ProcessInfo data
+ * @return CoreInfo*    the core
+ */
+CoreInfo *place_core(CPUInfo *cpu, CoreInfo *local, ProcessInfo *p){
+
+    CoreInfo *idlest = get_idlest_core(cpu, local);
+    if (cpu->core_place != SP_G_FLAG){
+        return idlest;
+    }
+
+    long long int total_speed = 0;
+    for (long long int i = 0; i < cpu->num_core; i++){
+        total_speed += cpu->core_lst[i]->speed;
+    }
+    int is_long = p->job_time * cpu->num_arrive >= cpu->total_job_time;
+
+    CoreInfo *placed = NULL;
+    long long int min_load = INVALID;
+    for (long long int i = 0; i < cpu->num_core; i++){
+        CoreInfo *core = cpu->core_lst[i];
+        int is_fast = core->speed * cpu->num_core > total_speed;
+        if (is_fast != is_long){
+            continue;
+        }
+        long long int load = get_queue_size(core->run_queue) 
+                                + (core->running != NULL);
+        if (placed == NULL || load < min_load 
+            || (load == min_load && core == local)){
+            placed = core;
+            min_load = load;
+        }
+    }
+
+    // If all cores run at the same speed, it is placed on the idlest core
+    if (placed == NULL){
+        return idlest;
+    }
+    return placed;
+}
+
+
+/**
+ * @brief  Put the processes which arrived into the run queues of the 
+ *         cores they are placed on
+ * 
+ * @param  cpu      a CPUInfo data
+ * @param  local    the CoreInfo data of the current event
+ * @param  queue    a queue of processes not arrived yet
+ */
+void add_core_arrival(CPUInfo *cpu, CoreInfo *local, Queue *queue){
+    while(get_queue_size(queue) > 0){
+        ProcessInfo *p = get_queue_point(queue, 0);
+        if (p->arrive_time <= cpu->curr_time){
+            cpu->total_job_time += p->job_time;
+            cpu->num_arrive ++;
+            CoreInfo *placed = place_core(cpu, local, p);
+            p->vruntime = placed->min_vruntime;
+            enqueue(placed->run_queue, dequeue(queue));
+        } else {
+            break;
+        }
+    }
+}
+
+
+/**
+ * @brief  Move the first process of the busiest run queue of the other 
+ *         cores to the run queue of an idle core, if there is one. Its 
+ *         virtual runtime moves by the difference of the smallest virtual
+ *         runtimes of the cores
+ * 
+ * @param  cpu      a CPUInfo data
+ * @param  core     a CoreInfo data with an empty run queue
+ */
+void steal_process(CPUInfo *cpu, CoreInfo *core){
+    CoreInfo *busiest = NULL;
+    for (long long int i = 0; i < cpu->num_core; i++){
+        CoreInfo *other = cpu->core_lst[i];
+        if (other != core && get_queue_size(other->run_queue) > 0 
+            && (busiest == NULL || get_queue_size(other->run_queue) 
+                                    > get_queue_size(busiest->run_queue))){
+            busiest = other;
+        }
+    }
+    if (busiest != NULL){
+        ProcessInfo *p = dequeue(busiest->run_queue);
+        p->vruntime += core->min_vruntime - busiest->min_vruntime;
+        enqueue(core->run_queue, p);
+        cpu->num_steal ++;
+    }
+}
+
+
+/**
+ * @brief  Return the number of processes running and waiting on all cores
+ * 
+ * @param  cpu              a CPUInfo data
+ * @return long long int    number of processes
+ */
+long long int count_core_process(CPUInfo *cpu){
+    long long int num_process = 0;
+    for (long long int i = 0; i < cpu->num_core; i++){
+        CoreInfo *core = cpu->core_lst[i];
+        num_process += get_queue_size(core->run_queue) 
+                        + (core->running != NULL);
+    }
+    return num_process;
+}
@@ -0,0 +1,232 @@
+/**
+ * @file      swapDevice.c
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Implementation of Swap device module, a disk which reads and
+ *            writes pages in contiguous runs (extents), each taking a seek
+ *            time, at a bandwidth. It includes
+ *              1. creating and destroying a swap device
+ *              2. reading pages of a process from its extents
+ *              3. writing evicted dirty pages of a process as an extent,
+ *                 batched with the last write to the same process
+ *              4. counting pages read and written and seeks for statistics
+ *
+ *            Each process records its number of pages and extents in swap.
+ *            Its pages never written to swap are read from its program as
+ *            one extent. The extents are assumed to be the same size, so
+ *            reading a part of the pages in swap reads the same part of
+ *            the extents
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#include "swapDevice.h"
+#include "utilities.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+/**
+ * @brief  A swap device records the seek time, the bandwidth (KB per unit
+ *         of time), the process written to last and the seeks and KB of the
+ *         writes not yet charged, and the number of pages read and written
+ *         and of seeks
+ */
+struct swap_device {
+    long long int seek_time;
+    long long int bandwidth;
+
+    ProcessInfo *last_write;
+    long long int pending_seek;
+    long long int pending_kb;
+
+    long long int num_read;
+    long long int num_write;
+    long long int num_seek;
+};
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+/**
+ * @brief  Create a new SwapDevice with a seek time and a bandwidth
+ *
+ * @param  seek_time        the time of a seek
+ * @param  bandwidth        the KB transferred per unit of time
+ * @return SwapDevice*      return a pointer to the new SwapDevice
+ */
+SwapDevice *new_SwapDevice(long long int seek_time, long long int bandwidth){
+
+    assert(seek_time >= 0 && bandwidth > 0);
+
+    SwapDevice *swap = (SwapDevice *)malloc(sizeof *swap);
+    if (swap == NULL) {
+        fprintf(stderr, "Error: new_SwapDevice() malloc returned NULL\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Initalise value of the SwapDevice
+    swap->seek_time = seek_time;
+    swap->bandwidth = bandwidth;
+    swap->last_write = NULL;
+    swap->pending_seek = INITIAL;
+    swap->pending_kb = INITIAL;
+    swap->num_read = INITIAL;
+    swap->num_write = INITIAL;
+    swap->num_seek = INITIAL;
+
+    return swap;
+}
+
+
+/**
+ * @brief  Destroy and free the memory associated with a SwapDevice
+ *
+ * @param  swap     a SwapDevice
+ */
+void free_SwapDevice(SwapDevice *swap){
+
+    // Error if the SwapDevice does not initalise
+    assert(swap != NULL);
+
+    // Free the SwapDevice itself
+    free(swap);
+    swap = NULL;
+}
+
+
+/**
+ * @brief  Return the time to read a number of pages of a process as one
+ *         batched request. Its pages in swap are read first, a seek for
+ *         each extent read, and the others are read from its program
+ *         with one seek
+ *
+ * @param  swap             a SwapDevice
+ * @param  p                a ProcessInfo data
+ * @param  num_page         number of pages
+ * @param  page_size        the page size in KB
+ * @return long long int    the reading time
+ */
+long long int read_swap(SwapDevice *swap, ProcessInfo *p,
+                        long long int num_page, long long int page_size){
+
+    if (num_page <= 0){
+        return 0;
+    }
+
+    long long int num_seek = 0;
+    long long int num_swap = num_page;
+    if (num_swap > p->swap_page){
+        num_swap = p->swap_page;
+    }
+    if (num_swap > 0){
+        long long int num_extent = (num_swap * p->swap_extent
+                                    + p->swap_page - 1) / p->swap_page;
+        p->swap_page -= num_swap;
+        p->swap_extent -= num_extent;
+        num_seek += num_extent;
+    }
+    if (num_swap < num_page){
+        num_seek++;
+    }
+
+    swap->num_read += num_page;
+    swap->num_seek += num_seek;
+    long long int num_kb = num_page * page_size;
+    return num_seek * swap->seek_time
+            + (num_kb + swap->bandwidth - 1) / swap->bandwidth;
+}
+
+
+/**
+ * @brief  Write a number of evicted pages of a process. Its clean pages
+ *         (loaded but not run yet) are evicted first and not written.
+ *         The dirty pages are written as a new extent, or added to the
+ *         last extent if the process is written to last in the batch
+ *
+ * @param  swap         a SwapDevice
+ * @param  p            a ProcessInfo data
+ * @param  num_page     number of pages evicted
+ * @param  page_size    the page size in KB
+ */
+void write_swap(SwapDevice *swap, ProcessInfo *p,
+                long long int num_page, long long int page_size){
+
+    long long int num_clean = num_page;
+    if (num_clean > p->num_clean_page){
+        num_clean = p->num_clean_page;
+    }
+    p->num_clean_page -= num_clean;
+    long long int num_dirty = num_page - num_clean;
+    if (num_dirty <= 0){
+        return;
+    }
+
+    if (swap->last_write != p){
+        swap->last_write = p;
+        swap->pending_seek++;
+        p->swap_extent++;
+    }
+    p->swap_page += num_dirty;
+    swap->pending_kb += num_dirty * page_size;
+    swap->num_write += num_dirty;
+}
+
+
+/**
+ * @brief  Return the time of the writes since the last time, and end the
+ *         batch so the next write starts a new extent
+ *
+ * @param  swap             a SwapDevice
+ * @return long long int    the writing time
+ */
+long long int flush_swap(SwapDevice *swap){
+
+    long long int write_time = swap->pending_seek * swap->seek_time
+            + (swap->pending_kb + swap->bandwidth - 1) / swap->bandwidth;
+
+    swap->num_seek += swap->pending_seek;
+    swap->last_write = NULL;
+    swap->pending_seek = INITIAL;
+    swap->pending_kb = INITIAL;
+    return write_time;
+}
+
+
+/**
+ * @brief  Return the number of pages read
+ *
+ * @param  swap             a SwapDevice
+ * @return long long int    number of pages
+ */
+long long int get_swap_read(SwapDevice *swap){
+    return swap->num_read;
+}
+
+
+/**
+ * @brief  Return the number of pages written
+ *
+ * @param  swap             a SwapDevice
+ * @return long long int    number of pages
+ */
+long long int get_swap_write(SwapDevice *swap){
+    return swap->num_write;
+}
+
+
+/**
+ * @brief  Return the number of seeks
+ *
+ * @param  swap             a SwapDevice
+ * @return long long int    number of seeks
+ */
+long long int get_swap_seek(SwapDevice *swap){
+    return swap->num_seek;
+}
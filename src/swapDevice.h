@@ -0,0 +1,58 @@
+/**
+ * @file      swapDevice.h
+ * @author    Erya Wen (eryaw@student.unimelb.edu.au)
+ * @brief     Swap device module, a disk which reads and writes pages in
+ *            contiguous runs (extents), each taking a seek time, at a
+ *            bandwidth. It includes
+ *              1. creating and destroying a swap device
+ *              2. reading pages of a process from its extents
+ *              3. writing evicted dirty pages of a process as an extent,
+ *                 batched with the last write to the same process
+ *              4. counting pages read and written and seeks for statistics
+ *
+ * @copyright created for COMP30023 Computer System 2020
+ *
+ */
+
+#ifndef SWAPDEVICE_H
+#define SWAPDEVICE_H
+
+#include "processInfo.h"
+
+
+// ============================================================================
+// == | Data Type Definitions
+// ============================================================================
+typedef struct swap_device SwapDevice;
+
+
+// ============================================================================
+// == | Module Functions
+// ============================================================================
+// Create a new SwapDevice with a seek time and a bandwidth
+SwapDevice *new_SwapDevice(long long int seek_time, long long int bandwidth);
+
+// Destroy and free the memory associated with a SwapDevice
+void free_SwapDevice(SwapDevice *swap);
+
+// Return the time to read a number of pages of a process
+long long int read_swap(SwapDevice *swap, ProcessInfo *p,
+                        long long int num_page, long long int page_size);
+
+// Write a number of evicted pages of a process, the dirty ones are written
+void write_swap(SwapDevice *swap, ProcessInfo *p,
+                long long int num_page, long long int page_size);
+
+// Return the time of the writes since the last time and end the batch
+long long int flush_swap(SwapDevice *swap);
+
+// Return the number of pages read
+long long int get_swap_read(SwapDevice *swap);
+
+// Return the number of pages written
+long long int get_swap_write(SwapDevice *swap);
+
+// Return the number of seeks
+long long int get_swap_seek(SwapDevice *swap);
+
+#endif
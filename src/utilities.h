@@ -24,10 +24,28 @@
 #define FF_A_FLAG               'F'
 #define RR_A_FLAG               'R'
 #define CS_A_FLAG               'S'
+#define SR_A_FLAG               'T'
+#define ML_A_FLAG               'L'
+#define CF_A_FLAG               'C'
 #define UN_M_FLAG               'U'
 #define SP_M_FLAG               'P'
 #define VM_M_FLAG               'V'
 #define CM_M_FLAG               'M'
+#define BU_M_FLAG               'B'
+#define CL_M_FLAG               'C'
+#define AR_M_FLAG               'A'
+#define LI_M_FLAG               'L'
+#define WS_M_FLAG               'W'
+#define FF_L_FLAG               'F'
+#define BF_L_FLAG               'B'
+#define NF_L_FLAG               'N'
+#define ID_G_FLAG               'I'
+#define SP_G_FLAG               'S'
+#define BASE_SPEED              100
+#define MAX_NUM_LEVEL           8
+#define MIN_NICE                -20
+#define MAX_NICE                19
+#define BITS_PER_WORD           64
 
 
 // ============================================================================